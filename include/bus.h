@@ -34,6 +34,12 @@ enum {
 extern "C" {
 #endif /* __cplusplus */
 
+void nes_bus_interrupt(
+	__in bool maskable
+	);
+
+void nes_bus_interrupt_clear(void);
+
 uint8_t nes_bus_read(
 	__in int bus,
 	__in uint16_t address
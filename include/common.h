@@ -30,7 +30,11 @@
 #include <string.h>
 #include <time.h>
 #include "./common/error.h"
+#include "./common/filter.h"
 #include "./common/mapper.h"
+#include "./common/movie.h"
+#include "./common/palette.h"
+#include "./common/rewind.h"
 #include "./common/trace.h"
 
 #endif /* NES_COMMON_H_ */
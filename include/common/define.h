@@ -36,19 +36,43 @@
 #define __out
 #endif /* __out */
 
+#define AUDIO_BLIP_MAX 0x1000
+#define AUDIO_BLIP_TAPS 16
+
+#define AUDIO_FRAME 0x4017
+
+#define AUDIO_PORT_BEGIN 0x4000
+#define AUDIO_PORT_END 0x4013
+
+#define AUDIO_RESAMPLE_TAPS 48
+
+#define AUDIO_SAMPLE_MAX 0x0400
+#define AUDIO_SAMPLE_RATE 44100
+
+#define AUDIO_STATUS 0x4015
+
 #define BLOCK_WIDTH 16
 
 #define BYTES_PER_KBYTE 1024
+#define BYTES_PER_MBYTE 0x100000
 
 #define CYCLES_PER_FRAME 29781
 
 #define FORMAT_MAX 512
 
-#define FRAME_FREQUENCY (MILLISEC_PER_SEC / (float)FRAMES_PER_SEC)
+#define INPUT_CONTROLLER_1 0x4016
+#define INPUT_CONTROLLER_2 0x4017
+
 #define FRAMES_PER_SEC 60
 
+#define MICROSEC_PER_MILLISEC 1000
+
 #define MILLISEC_PER_SEC 1000
 
+#define NANOSEC_PER_MICROSEC 1000
+#define NANOSEC_PER_MILLISEC 1000000
+#define NANOSEC_PER_SEC 1000000000
+
 #define NES "NES"
 
 #define OBJECT_RAM_BEGIN 0x0000
@@ -73,10 +97,20 @@
 #define PROCESSOR_WORK_RAM_BEGIN 0x6000
 #define PROCESSOR_WORK_RAM_END 0x7fff
 
+#define REWIND_REGION_MAX 8
+
 #define STACK_ADDRESS 0x0100
 
 #define VIDEO_ADDRESS_MIRROR 0x4000
 
+#define VIDEO_COLOR_EMPHASIS 0x01c0
+#define VIDEO_COLOR_EMPHASIS_SHIFT 6
+#define VIDEO_COLOR_GRAYSCALE 0x0200
+#define VIDEO_COLOR_MAX 0x0400
+#define VIDEO_COLOR_PALETTE 0x0040
+
+#define VIDEO_HEIGHT 240
+
 #define VIDEO_PALETTE_RAM_BEGIN 0x3f00
 #define VIDEO_PALETTE_RAM_END 0x3fff
 #define VIDEO_PALETTE_RAM_FILL 0x3f
@@ -94,9 +128,36 @@
 #define VIDEO_ROM_BEGIN 0x0000
 #define VIDEO_ROM_END 0x1fff
 
+#define VIDEO_WIDTH 256
+
 #define ADDRESS_WIDTH(_BEGIN_, _END_) \
         (((_END_) - (_BEGIN_)) + 1)
 
+enum {
+        AUDIO_PORT_PULSE_1_CONTROL = 0, /* 0x4000 */
+        AUDIO_PORT_PULSE_1_SWEEP, /* 0x4001 */
+        AUDIO_PORT_PULSE_1_TIMER_LOW, /* 0x4002 */
+        AUDIO_PORT_PULSE_1_TIMER_HIGH, /* 0x4003 */
+        AUDIO_PORT_PULSE_2_CONTROL, /* 0x4004 */
+        AUDIO_PORT_PULSE_2_SWEEP, /* 0x4005 */
+        AUDIO_PORT_PULSE_2_TIMER_LOW, /* 0x4006 */
+        AUDIO_PORT_PULSE_2_TIMER_HIGH, /* 0x4007 */
+        AUDIO_PORT_TRIANGLE_CONTROL, /* 0x4008 */
+        AUDIO_PORT_TRIANGLE_UNUSED, /* 0x4009 */
+        AUDIO_PORT_TRIANGLE_TIMER_LOW, /* 0x400a */
+        AUDIO_PORT_TRIANGLE_TIMER_HIGH, /* 0x400b */
+        AUDIO_PORT_NOISE_CONTROL, /* 0x400c */
+        AUDIO_PORT_NOISE_UNUSED, /* 0x400d */
+        AUDIO_PORT_NOISE_PERIOD, /* 0x400e */
+        AUDIO_PORT_NOISE_LENGTH, /* 0x400f */
+        AUDIO_PORT_DMC_CONTROL, /* 0x4010 */
+        AUDIO_PORT_DMC_LOAD, /* 0x4011 */
+        AUDIO_PORT_DMC_ADDRESS, /* 0x4012 */
+        AUDIO_PORT_DMC_LENGTH, /* 0x4013 */
+        AUDIO_PORT_STATUS = 0x15, /* 0x4015 */
+        AUDIO_PORT_FRAME = 0x17, /* 0x4017 */
+};
+
 enum {
         VIDEO_PORT_CONTROL = 0, /* 0x2000 */
         VIDEO_PORT_MASK, /* 0x2001 */
@@ -0,0 +1,60 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NES_MOVIE_H_
+#define NES_MOVIE_H_
+
+#include <stdio.h>
+#include "./buffer.h"
+
+typedef struct {
+	nes_buffer_t data;
+	FILE *file;
+	uint64_t frame;
+	int mode;
+	size_t offset;
+	uint32_t run;
+	uint8_t state[NES_CONTROLLER_MAX];
+} nes_movie_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+int nes_movie_frame(
+	__inout nes_movie_t *movie,
+	__inout uint8_t *state
+	);
+
+int nes_movie_load(
+	__in const nes_t *configuration,
+	__inout nes_movie_t *movie
+	);
+
+void nes_movie_unload(
+	__inout nes_movie_t *movie
+	);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NES_MOVIE_H_ */
@@ -0,0 +1,58 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NES_PALETTE_H_
+#define NES_PALETTE_H_
+
+#include "./buffer.h"
+
+typedef union {
+
+        struct {
+                uint8_t blue;
+                uint8_t green;
+                uint8_t red;
+                uint8_t alpha;
+        };
+
+        uint32_t raw;
+} nes_color_t;
+
+typedef struct {
+	nes_color_t color[VIDEO_COLOR_MAX];
+	uint8_t indexed[VIDEO_COLOR_MAX];
+	uint16_t rgb565[VIDEO_COLOR_MAX];
+} nes_palette_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+int nes_palette_load(
+	__inout nes_palette_t *palette,
+	__in const nes_buffer_t *data
+	);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NES_PALETTE_H_ */
@@ -0,0 +1,88 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NES_REWIND_H_
+#define NES_REWIND_H_
+
+#include "./buffer.h"
+
+typedef struct {
+	uint32_t count;
+	nes_buffer_t current;
+	nes_buffer_t data;
+	nes_buffer_t dirty;
+	size_t head;
+	size_t length;
+	size_t page[REWIND_REGION_MAX + 1];
+	nes_buffer_t region[REWIND_REGION_MAX];
+	size_t region_count;
+	nes_buffer_t scratch;
+	size_t tail;
+} nes_rewind_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void nes_rewind_dirty(
+	__inout nes_rewind_t *rewind,
+	__in int region,
+	__in size_t offset
+	);
+
+const uint8_t *nes_rewind_image(
+	__in const nes_rewind_t *rewind,
+	__in int region
+	);
+
+void nes_rewind_invalidate(
+	__inout nes_rewind_t *rewind,
+	__in int region
+	);
+
+int nes_rewind_load(
+	__inout nes_rewind_t *rewind,
+	__in const nes_buffer_t *region,
+	__in size_t count,
+	__in size_t capacity
+	);
+
+int nes_rewind_pop(
+	__inout nes_rewind_t *rewind
+	);
+
+void nes_rewind_push(
+	__inout nes_rewind_t *rewind
+	);
+
+void nes_rewind_restore(
+	__inout nes_rewind_t *rewind
+	);
+
+void nes_rewind_unload(
+	__inout nes_rewind_t *rewind
+	);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NES_REWIND_H_ */
@@ -69,9 +69,59 @@ enum {
         NES_ACTION_MAPPER_READ, /* Read mapper register */
         NES_ACTION_MAPPER_WRITE, /* Write mapper register */
         NES_ACTION_CARTRIDGE_HEADER, /* Read cartridge header */
+        NES_ACTION_INPUT_READ, /* Read controller button state */
+        NES_ACTION_INPUT_WRITE, /* Write controller button state */
+        NES_ACTION_SPEED_READ, /* Read fast-forward frame skip */
+        NES_ACTION_SPEED_WRITE, /* Write fast-forward frame skip */
         NES_ACTION_MAX,
 };
 
+/**
+ * NES button enum
+ */
+enum {
+        NES_BUTTON_A = 0, /* A button */
+        NES_BUTTON_B, /* B button */
+        NES_BUTTON_SELECT, /* Select button */
+        NES_BUTTON_START, /* Start button */
+        NES_BUTTON_UP, /* Up direction */
+        NES_BUTTON_DOWN, /* Down direction */
+        NES_BUTTON_LEFT, /* Left direction */
+        NES_BUTTON_RIGHT, /* Right direction */
+        NES_BUTTON_MAX,
+};
+
+/**
+ * NES controller enum
+ */
+enum {
+        NES_CONTROLLER_1 = 0, /* Controller 1 ($4016) */
+        NES_CONTROLLER_2, /* Controller 2 ($4017) */
+        NES_CONTROLLER_MAX,
+};
+
+/**
+ * NES filter enum
+ */
+enum {
+        NES_FILTER_NONE = 0, /* No post-process filter */
+        NES_FILTER_SCALE2X, /* Scale2x filter (2x) */
+        NES_FILTER_SCALE3X, /* Scale3x filter (3x) */
+        NES_FILTER_HQ2X, /* HQ2x filter (2x) */
+        NES_FILTER_NTSC, /* NTSC composite filter (2x) */
+        NES_FILTER_MAX,
+};
+
+/**
+ * NES format enum
+ */
+enum {
+        NES_FORMAT_ARGB8888 = 0, /* 32-bit color (4 bytes per pixel) */
+        NES_FORMAT_RGB565, /* 16-bit color (2 bytes per pixel) */
+        NES_FORMAT_INDEXED8, /* 8-bit palette index (1 byte per pixel) */
+        NES_FORMAT_MAX,
+};
+
 /**
  * NES mapper enum
  */
@@ -98,6 +148,16 @@ enum {
         NES_PROCESSOR_MAX,
 };
 
+/**
+ * NES replay enum
+ */
+enum {
+        NES_REPLAY_NONE = 0, /* No movie */
+        NES_REPLAY_RECORD, /* Record controller input to movie */
+        NES_REPLAY_PLAYBACK, /* Playback controller input from movie */
+        NES_REPLAY_MAX,
+};
+
 /**
  * NES video enum
  */
@@ -126,10 +186,61 @@ typedef struct {
  * NES display struct
  */
 typedef struct {
+        unsigned band; /* Display band rendering threads */
+        int filter; /* Display post-process filter */
+        int format; /* Display framebuffer format */
         bool fullscreen; /* DIsplay fullscreen */
+        nes_buffer_t palette; /* Display palette (.pal) data */
+        bool pipeline; /* Display pipelined rendering */
+        unsigned runahead; /* Display frames run ahead of input (0-4) */
         unsigned scale; /* Display scale */
+        unsigned skip; /* Display every Nth frame during fast-forward */
 } nes_display_t;
 
+/**
+ * NES frame struct
+ */
+typedef struct {
+        const void *buffer; /* Frame buffer (valid only during the callback) */
+        int format; /* Frame buffer format */
+        uint32_t height; /* Frame height in pixels */
+        uint64_t number; /* Frame number */
+        size_t pitch; /* Frame row length in bytes */
+        uint32_t width; /* Frame width in pixels */
+} nes_frame_t;
+
+/**
+ * NES samples struct
+ */
+typedef struct {
+        const int16_t *buffer; /* Sample buffer (valid only during the callback) */
+        uint32_t count; /* Sample count */
+        unsigned rate; /* Sample rate in Hz */
+} nes_samples_t;
+
+/**
+ * NES audio callback
+ * @param[in] Pointer to samples struct
+ * @param[in] Pointer to callback context
+ */
+typedef void (*nes_audio_cb)(const nes_samples_t *, void *);
+
+/**
+ * NES frame callback
+ * @param[in] Pointer to frame struct
+ * @param[in] Pointer to callback context
+ */
+typedef void (*nes_frame_cb)(const nes_frame_t *, void *);
+
+/**
+ * NES callback struct
+ */
+typedef struct {
+        nes_audio_cb audio; /* Audio callback, called with each block of mono samples (optional) */
+        void *context; /* Callback context */
+        nes_frame_cb frame; /* Frame callback, called after each displayed frame (optional) */
+} nes_callback_t;
+
 /**
  * NES header struct
  */
@@ -195,6 +306,15 @@ typedef union {
         uint32_t dword; /* Double-word */
 } nes_register_t;
 
+/**
+ * NES replay struct
+ */
+typedef struct {
+        int mode; /* Replay mode */
+        const char *path; /* Replay movie path */
+        unsigned rewind; /* Replay rewind buffer size in MB (0 disables) */
+} nes_replay_t;
+
 /**
  * NES ROM struct
  */
@@ -203,13 +323,23 @@ typedef struct {
         const char *path; /* ROM path */
 } nes_rom_t;
 
+/**
+ * NES sound struct
+ */
+typedef struct {
+        unsigned rate; /* Sound sample rate in Hz (44100 or 48000) */
+} nes_sound_t;
+
 /**
  * NES configuration struct
  */
 typedef struct {
 #if NES_API_VERSION >= NES_API_VERSION_1
+        nes_callback_t callback; /* Callback configuration */
         nes_display_t display; /* Display configuration */
+        nes_replay_t replay; /* Replay configuration */
         nes_rom_t rom; /* ROM configuration */
+        nes_sound_t sound; /* Sound configuration */
 #endif /* NES_API_VERSION >= NES_API_VERSION_1 */
 } nes_t;
 
@@ -24,12 +24,19 @@
 
 #include "./common.h"
 
+static const size_t FORMAT_WIDTH[] = {
+	sizeof(nes_color_t), /* NES_FORMAT_ARGB8888 */
+	sizeof(uint16_t), /* NES_FORMAT_RGB565 */
+	sizeof(uint8_t), /* NES_FORMAT_INDEXED8 */
+	};
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
 
-bool nes_service_key(
-	__in int key
+float nes_service_audio(
+	__in const int16_t *sample,
+	__in uint32_t count
 	);
 
 int nes_service_load(
@@ -37,14 +44,20 @@ int nes_service_load(
 	);
 
 void nes_service_pixel(
-	__in uint8_t color,
+	__in uint16_t color,
 	__in uint32_t x,
 	__in uint32_t y
 	);
 
-int nes_service_poll(void);
+int nes_service_poll(
+	__inout uint8_t *state,
+	__inout unsigned *speed,
+	__inout bool *rewind
+	);
 
-int nes_service_show(void);
+int nes_service_show(
+	__in bool skip
+	);
 
 void nes_service_unload(void);
 
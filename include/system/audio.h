@@ -0,0 +1,200 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NES_AUDIO_H_
+#define NES_AUDIO_H_
+
+#include "../bus.h"
+
+enum {
+        AUDIO_CHANNEL_PULSE_1 = 0,
+        AUDIO_CHANNEL_PULSE_2,
+        AUDIO_CHANNEL_TRIANGLE,
+        AUDIO_CHANNEL_NOISE,
+        AUDIO_CHANNEL_DMC,
+        AUDIO_CHANNEL_MAX,
+};
+
+typedef union {
+
+        struct {
+                uint8_t volume : 4;
+                uint8_t constant : 1;
+                uint8_t halt : 1;
+                uint8_t duty : 2;
+        };
+
+        uint8_t raw;
+} nes_audio_control_t;
+
+typedef union {
+
+        struct {
+                uint8_t pulse_1 : 1;
+                uint8_t pulse_2 : 1;
+                uint8_t triangle : 1;
+                uint8_t noise : 1;
+                uint8_t dmc : 1;
+                uint8_t unused : 1;
+                uint8_t frame_interrupt : 1;
+                uint8_t dmc_interrupt : 1;
+        };
+
+        uint8_t raw;
+} nes_audio_status_t;
+
+typedef union {
+
+        struct {
+                uint8_t shift : 3;
+                uint8_t negate : 1;
+                uint8_t period : 3;
+                uint8_t enabled : 1;
+        };
+
+        uint8_t raw;
+} nes_audio_sweep_t;
+
+typedef struct {
+        nes_audio_control_t control;
+        uint8_t decay;
+        uint8_t divider;
+        bool start;
+} nes_audio_envelope_t;
+
+typedef struct {
+        uint16_t address;
+        uint8_t bits;
+        uint8_t buffer;
+        bool empty;
+        bool interrupt;
+        uint16_t length;
+        bool loop;
+        uint8_t output;
+        uint16_t period;
+        uint16_t remaining;
+        uint8_t shift;
+        bool silence;
+        uint16_t start;
+        uint32_t timer;
+} nes_audio_dmc_t;
+
+typedef struct {
+        bool inhibit;
+        bool mode;
+        uint8_t step;
+        uint32_t timer;
+} nes_audio_frame_t;
+
+typedef struct {
+        nes_audio_envelope_t envelope;
+        uint8_t length;
+        bool mode;
+        uint16_t period;
+        uint16_t shift;
+        uint32_t timer;
+} nes_audio_noise_t;
+
+typedef struct {
+        nes_audio_envelope_t envelope;
+        uint8_t length;
+        uint16_t period;
+        uint8_t sequence;
+        nes_audio_sweep_t sweep;
+        uint8_t sweep_divider;
+        bool sweep_reload;
+        uint32_t timer;
+} nes_audio_pulse_t;
+
+typedef struct {
+        bool control;
+        uint8_t length;
+        uint8_t linear;
+        uint8_t linear_load;
+        bool linear_reload;
+        uint16_t period;
+        uint8_t sequence;
+        uint32_t timer;
+} nes_audio_triangle_t;
+
+typedef struct {
+        float blip[AUDIO_BLIP_MAX + AUDIO_BLIP_TAPS];
+        uint64_t blip_cycle;
+        float blip_level;
+        uint64_t cycle;
+        nes_audio_dmc_t dmc;
+        uint64_t event;
+        float filter[2];
+        nes_audio_frame_t frame;
+        uint8_t level[AUDIO_CHANNEL_MAX];
+        nes_audio_noise_t noise;
+        nes_audio_pulse_t pulse[2];
+        uint8_t rate;
+        float resample[AUDIO_RESAMPLE_TAPS + AUDIO_BLIP_MAX];
+        uint32_t resample_count;
+        uint64_t resample_position;
+        int16_t sample[AUDIO_SAMPLE_MAX];
+        uint16_t sample_count;
+        bool skip;
+        nes_audio_status_t status;
+        uint32_t step;
+        nes_audio_triangle_t triangle;
+} nes_audio_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void nes_audio_flush(
+        __inout nes_audio_t *audio,
+        __in uint64_t cycle
+        );
+
+int nes_audio_load(
+        __inout nes_audio_t *audio,
+        __in unsigned rate
+        );
+
+uint8_t nes_audio_port_read(
+        __inout nes_audio_t *audio,
+        __in uint16_t address
+        );
+
+void nes_audio_port_write(
+        __inout nes_audio_t *audio,
+        __in uint16_t address,
+        __in uint8_t data
+        );
+
+void nes_audio_reset(
+        __inout nes_audio_t *audio
+        );
+
+void nes_audio_synchronize(
+        __inout nes_audio_t *audio,
+        __in uint64_t cycle
+        );
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NES_AUDIO_H_ */
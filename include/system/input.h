@@ -0,0 +1,55 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NES_INPUT_H_
+#define NES_INPUT_H_
+
+#include "../bus.h"
+
+typedef struct {
+        uint8_t shift[NES_CONTROLLER_MAX];
+        uint8_t state[NES_CONTROLLER_MAX];
+        bool strobe;
+} nes_input_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+uint8_t nes_input_port_read(
+        __inout nes_input_t *input,
+        __in uint8_t controller
+        );
+
+void nes_input_port_write(
+        __inout nes_input_t *input,
+        __in uint8_t data
+        );
+
+void nes_input_reset(
+        __inout nes_input_t *input
+        );
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NES_INPUT_H_ */
@@ -66,6 +66,10 @@ void nes_processor_interrupt(
         __in bool maskable
         );
 
+void nes_processor_interrupt_clear(
+        __inout nes_processor_t *processor
+        );
+
 void nes_processor_reset(
         __inout nes_processor_t *processor
         );
@@ -93,25 +93,96 @@ typedef union {
         uint8_t raw;
 } nes_video_status_t;
 
+typedef union {
+
+        struct {
+                uint8_t palette : 2;
+                uint8_t unused : 3;
+                uint8_t priority : 1;
+                uint8_t flip_horizontal : 1;
+                uint8_t flip_vertical : 1;
+        };
+
+        uint8_t raw;
+} nes_video_sprite_attribute_t;
+
+typedef struct {
+        uint8_t y;
+        uint8_t tile;
+        nes_video_sprite_attribute_t attribute;
+        uint8_t x;
+} nes_video_sprite_t;
+
 typedef struct {
         nes_register_t address;
         bool address_latch;
+        struct nes_video_band_s *band;
+        uint64_t blank;
+        uint16_t color;
+        bool complete;
         nes_video_control_t control;
-        uint8_t cycles;
-        uint16_t cycles_frame;
+        uint64_t cycle;
         nes_register_t data;
+        uint16_t dot;
+        uint64_t event;
+        uint64_t frame;
+        uint16_t (*frame_buffer)[VIDEO_WIDTH];
+        uint32_t hit;
+        uint8_t line[VIDEO_WIDTH];
         nes_video_mask_t mask;
         nes_register_t object_address;
         nes_register_t object_data;
+        struct nes_video_pipeline_s *pipeline;
+        bool predict;
+        uint16_t scanline;
         nes_register_t scroll_x;
         nes_register_t scroll_y;
+        struct nes_video_shadow_s *shadow;
+        bool skip;
+        uint16_t span;
         nes_video_status_t status;
+        struct nes_video_surface_s *surface;
 } nes_video_t;
 
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
 
+int nes_video_band_load(
+        __inout nes_video_t *video,
+        __in unsigned count
+        );
+
+void nes_video_band_unload(
+        __inout nes_video_t *video
+        );
+
+void nes_video_invalidate(
+        __inout nes_video_t *video,
+        __in uint16_t address
+        );
+
+void nes_video_mask(
+        __inout nes_video_t *video,
+        __in uint8_t data
+        );
+
+int nes_video_pipeline_load(
+        __inout nes_video_t *video
+        );
+
+void nes_video_pipeline_unload(
+        __inout nes_video_t *video
+        );
+
+int nes_video_surface_load(
+        __inout nes_video_t *video
+        );
+
+void nes_video_surface_unload(
+        __inout nes_video_t *video
+        );
+
 uint8_t nes_video_port_read(
         __inout nes_video_t *video,
         __in uint16_t address
@@ -128,7 +199,13 @@ void nes_video_reset(
         );
 
 bool nes_video_step(
-        __inout nes_video_t *video
+        __inout nes_video_t *video,
+        __in uint64_t cycle
+        );
+
+void nes_video_synchronize(
+        __inout nes_video_t *video,
+        __in uint64_t cycle
         );
 
 #ifdef __cplusplus
@@ -115,6 +115,84 @@ exit:
         return result;
 }
 
+void
+nes_action_frame(
+        __inout nes_bus_t *bus,
+        __in bool skip
+        )
+{
+        bool complete = false;
+
+        bus->video.skip = skip;
+
+        do {
+                nes_processor_step(&bus->processor);
+
+                /* TODO: STEP SUBSYSTEMS */
+
+                if((++bus->cycle >= bus->video.event) || bus->video.complete) {
+                        complete = nes_video_step(&bus->video, bus->cycle);
+                }
+
+                if(bus->cycle >= bus->audio.event) {
+                        nes_audio_synchronize(&bus->audio, bus->cycle);
+                }
+
+                TRACE_STEP();
+        } while(!complete);
+
+        nes_audio_flush(&bus->audio, bus->cycle);
+}
+
+int
+nes_action_input_read(
+        __in nes_bus_t *bus,
+        __in const nes_action_t *request,
+        __inout nes_action_t *response
+        )
+{
+        int result = NES_OK;
+
+        if(!response) {
+                result = ERROR(NES_ERR, "invalid response -- %p", response);
+                goto exit;
+        }
+
+        if(request->address.word >= NES_CONTROLLER_MAX) {
+                result = ERROR(NES_ERR, "invalid input controller read -- %i", request->address.word);
+                goto exit;
+        }
+
+        response->type = request->type;
+        response->address.word = request->address.word;
+        response->data.dword = bus->input.state[request->address.word];
+        TRACE(LEVEL_VERBOSE, "Input read [CONTROLLER%u]->%02X", request->address.word + 1, response->data.low);
+
+exit:
+        return result;
+}
+
+int
+nes_action_input_write(
+        __in nes_bus_t *bus,
+        __in const nes_action_t *request,
+        __inout nes_action_t *response
+        )
+{
+        int result = NES_OK;
+
+        if(request->address.word >= NES_CONTROLLER_MAX) {
+                result = ERROR(NES_ERR, "invalid input controller write -- %i", request->address.word);
+                goto exit;
+        }
+
+        bus->input.state[request->address.word] = request->data.low;
+        TRACE(LEVEL_VERBOSE, "Input write [CONTROLLER%u]<-%02X", request->address.word + 1, request->data.low);
+
+exit:
+        return result;
+}
+
 int
 nes_action_mapper_read(
         __in nes_bus_t *bus,
@@ -311,29 +389,55 @@ nes_action_run(
         )
 {
         int result = NES_OK;
+        bool rewind = false;
 
         TRACE(LEVEL_INFORMATION, "%s", "Emulation running");
 
         for(;;) {
-                bool complete = false;
 
-                if(nes_service_poll() != NES_OK) {
+                if((nes_service_poll(bus->input.state, &bus->speed, &rewind) != NES_OK)
+                                || ((result = nes_movie_frame(&bus->movie, bus->input.state)) != NES_OK)) {
                         result = (result == NES_EVT) ? NES_OK : result;
                         break;
                 }
 
-                do {
-                        nes_processor_step(&bus->processor);
-
-                        /* TODO: STEP SUBSYSTEMS */
-
-                        complete = nes_video_step(&bus->video);
-                        TRACE_STEP();
-                } while(!complete);
+                if(rewind && bus->rewind.enabled) {
+
+                        /* Re-run the restored frame silently so it is displayed, then discard it on the next pop */
+                        if(nes_bus_rewind_pop() == NES_OK) {
+                                bus->audio.skip = true;
+                                nes_action_frame(bus, false);
+                                bus->audio.skip = false;
+                        }
+
+                        result = nes_service_show(false);
+                } else if(bus->runahead && !bus->speed) {
+                        nes_action_frame(bus, true);
+                        nes_bus_save(&bus->state);
+                        bus->audio.skip = true;
+
+                        for(unsigned frame = 1; frame <= bus->runahead; ++frame) {
+                                nes_action_frame(bus, frame < bus->runahead);
+                        }
+
+                        result = nes_service_show(false);
+                        nes_bus_restore(&bus->state);
+                } else {
+
+                        /* Drop the audio of skipped frames too, so captures keep one audio frame per displayed video frame */
+                        bus->audio.skip = (bus->speed > 1) && (bus->video.frame % bus->speed);
+                        nes_action_frame(bus, bus->audio.skip);
+                        bus->audio.skip = false;
+                        result = nes_service_show(bus->video.skip);
+                }
 
-                if((result = nes_service_show()) != NES_OK) {
+                if(result != NES_OK) {
                         break;
                 }
+
+                if(bus->rewind.enabled && !rewind) {
+                        nes_bus_rewind_push();
+                }
         }
 
         TRACE(LEVEL_INFORMATION, "%s", "Emulation paused");
@@ -341,6 +445,43 @@ nes_action_run(
         return result;
 }
 
+int
+nes_action_speed_read(
+        __in nes_bus_t *bus,
+        __in const nes_action_t *request,
+        __inout nes_action_t *response
+        )
+{
+        int result = NES_OK;
+
+        if(!response) {
+                result = ERROR(NES_ERR, "invalid response -- %p", response);
+                goto exit;
+        }
+
+        response->type = request->type;
+        response->data.dword = bus->speed;
+        TRACE(LEVEL_VERBOSE, "Speed read->%u", response->data.dword);
+
+exit:
+        return result;
+}
+
+int
+nes_action_speed_write(
+        __in nes_bus_t *bus,
+        __in const nes_action_t *request,
+        __inout nes_action_t *response
+        )
+{
+        int result = NES_OK;
+
+        bus->speed = request->data.dword;
+        TRACE(LEVEL_VERBOSE, "Speed write<-%u", bus->speed);
+
+        return result;
+}
+
 int
 nes_action_step(
         __in nes_bus_t *bus,
@@ -349,10 +490,12 @@ nes_action_step(
         )
 {
         int result = NES_OK;
+        bool rewind = false;
 
         TRACE(LEVEL_INFORMATION, "%s", "Emulation stepping");
+        bus->video.skip = false;
 
-        if(nes_service_poll() != NES_OK) {
+        if(nes_service_poll(bus->input.state, &bus->speed, &rewind) != NES_OK) {
                 result = (result == NES_EVT) ? NES_OK : result;
                 goto exit;
         }
@@ -362,10 +505,15 @@ nes_action_step(
 
                 /* TODO: STEP SUBSYSTEMS */
 
-                nes_video_step(&bus->video);
+                if(nes_video_step(&bus->video, ++bus->cycle)) {
+                        nes_audio_flush(&bus->audio, bus->cycle);
+                } else if(bus->cycle >= bus->audio.event) {
+                        nes_audio_synchronize(&bus->audio, bus->cycle);
+                }
+
                 TRACE_STEP();
 
-                if((result = nes_service_show()) != NES_OK) {
+                if((result = nes_service_show(false)) != NES_OK) {
                         goto exit;
                 }
         } while(bus->processor.cycles);
@@ -374,10 +522,15 @@ nes_action_step(
 
         /* TODO: STEP SUBSYSTEMS */
 
-        nes_video_step(&bus->video);
+        if(nes_video_step(&bus->video, ++bus->cycle)) {
+                nes_audio_flush(&bus->audio, bus->cycle);
+        } else if(bus->cycle >= bus->audio.event) {
+                nes_audio_synchronize(&bus->audio, bus->cycle);
+        }
+
         TRACE_STEP();
 
-        if((result = nes_service_show()) != NES_OK) {
+        if((result = nes_service_show(false)) != NES_OK) {
                 goto exit;
         }
 
@@ -465,7 +618,7 @@ nes_action_video_write(
                         TRACE(LEVEL_VERBOSE, "Video write [CONTROL]<-%02X", bus->video.control.raw);
                         break;
                 case NES_VIDEO_MASK:
-                        bus->video.mask.raw = request->data.low;
+                        nes_video_mask(&bus->video, request->data.low);
                         TRACE(LEVEL_VERBOSE, "Video write [MASK]<-%02X", bus->video.mask.raw);
                         break;
                 case NES_VIDEO_STATUS:
@@ -52,6 +52,23 @@ int nes_action_cartridge_header(
         __inout nes_action_t *response
         );
 
+void nes_action_frame(
+        __inout nes_bus_t *bus,
+        __in bool skip
+        );
+
+int nes_action_input_read(
+        __in nes_bus_t *bus,
+        __in const nes_action_t *request,
+        __inout nes_action_t *response
+        );
+
+int nes_action_input_write(
+        __in nes_bus_t *bus,
+        __in const nes_action_t *request,
+        __inout nes_action_t *response
+        );
+
 int nes_action_mapper_read(
         __in nes_bus_t *bus,
         __in const nes_action_t *request,
@@ -82,6 +99,18 @@ int nes_action_run(
         __inout nes_action_t *response
         );
 
+int nes_action_speed_read(
+        __in nes_bus_t *bus,
+        __in const nes_action_t *request,
+        __inout nes_action_t *response
+        );
+
+int nes_action_speed_write(
+        __in nes_bus_t *bus,
+        __in const nes_action_t *request,
+        __inout nes_action_t *response
+        );
+
 int nes_action_step(
         __in nes_bus_t *bus,
         __in const nes_action_t *request,
@@ -112,6 +141,10 @@ static const nes_action_hdlr ACTION_HDLR[] = {
         nes_action_mapper_read, /* NES_ACTION_MAPPER_READ */
         nes_action_mapper_write, /* NES_ACTION_MAPPER_WRITE */
         nes_action_cartridge_header, /* NES_ACTION_CARTRIDGE_HEADER */
+        nes_action_input_read, /* NES_ACTION_INPUT_READ */
+        nes_action_input_write, /* NES_ACTION_INPUT_WRITE */
+        nes_action_speed_read, /* NES_ACTION_SPEED_READ */
+        nes_action_speed_write, /* NES_ACTION_SPEED_WRITE */
         };
 
 #ifdef __cplusplus
@@ -33,6 +33,69 @@ nes_bus(void)
 	return &g_bus;
 }
 
+void
+nes_bus_core_load(
+	__in const nes_bus_core_t *core
+	)
+{
+	g_bus.audio = core->audio;
+	g_bus.cycle = core->cycle;
+	g_bus.input = core->input;
+	g_bus.mapper = core->mapper;
+	g_bus.processor = core->processor;
+	g_bus.video = core->video;
+}
+
+void
+nes_bus_core_save(
+	__inout nes_bus_core_t *core
+	)
+{
+	core->audio = g_bus.audio;
+	core->cycle = g_bus.cycle;
+	core->input = g_bus.input;
+	core->mapper = g_bus.mapper;
+	core->processor = g_bus.processor;
+	core->video = g_bus.video;
+}
+
+void
+nes_bus_interrupt(
+	__in bool maskable
+	)
+{
+	nes_processor_interrupt(&g_bus.processor, maskable);
+}
+
+void
+nes_bus_interrupt_clear(void)
+{
+	nes_processor_interrupt_clear(&g_bus.processor);
+}
+
+void
+nes_bus_invalidate(
+	__in const uint8_t *ram_video,
+	__in const uint8_t *ram_character,
+	__in size_t length
+	)
+{
+
+	for(uint16_t address = 0; address < VIDEO_RAM_WIDTH; ++address) {
+
+		if(g_bus.ram_video.ptr[address] != ram_video[address]) {
+			nes_video_invalidate(&g_bus.video, VIDEO_RAM_BEGIN + address);
+		}
+	}
+
+	if(length && memcmp(g_bus.mapper.cartridge.ram[RAM_CHARACTER].ptr, ram_character, length)) {
+
+		for(uint16_t address = VIDEO_ROM_BEGIN; address <= VIDEO_ROM_END; ++address) {
+			nes_video_invalidate(&g_bus.video, address);
+		}
+	}
+}
+
 int
 nes_bus_load(
 	__in const nes_t *configuration
@@ -42,6 +105,17 @@ nes_bus_load(
 
 	TRACE(LEVEL_VERBOSE, "%s", "Bus loading");
 
+	if(configuration->display.runahead > BUS_RUNAHEAD_MAX) {
+		result = ERROR(NES_ERR, "invalid run-ahead frame count -- %u (expecting 0-%u)", configuration->display.runahead, BUS_RUNAHEAD_MAX);
+		goto exit;
+	}
+
+	/* Movies advance one input frame per loop, so rewound frames would desynchronize them from the machine */
+	if(configuration->replay.rewind && (configuration->replay.mode != NES_REPLAY_NONE)) {
+		result = ERROR(NES_ERR, "invalid rewind with movie replay -- %i", configuration->replay.mode);
+		goto exit;
+	}
+
 	if((result = nes_buffer_allocate(&g_bus.ram_object, OBJECT_RAM_WIDTH, OBJECT_RAM_FILL)) != NES_OK) {
 		goto exit;
 	}
@@ -62,8 +136,72 @@ nes_bus_load(
 		goto exit;
 	}
 
+	if(configuration->display.runahead && configuration->display.pipeline) {
+		TRACE(LEVEL_WARNING, "%s", "Bus run-ahead ignored with pipelined rendering");
+	} else if(configuration->display.runahead) {
+
+		for(int type = 0; type < RAM_MAX; ++type) {
+
+			if(g_bus.mapper.cartridge.ram[type].length
+					&& ((result = nes_buffer_allocate(&g_bus.state.ram_cartridge[type], g_bus.mapper.cartridge.ram[type].length, 0)) != NES_OK)) {
+				goto exit;
+			}
+		}
+
+		g_bus.runahead = configuration->display.runahead;
+		TRACE(LEVEL_VERBOSE, "Bus run-ahead: %u", g_bus.runahead);
+	}
+
+	nes_audio_reset(&g_bus.audio);
+	nes_input_reset(&g_bus.input);
 	nes_processor_reset(&g_bus.processor);
 	nes_video_reset(&g_bus.video);
+
+	if((result = nes_audio_load(&g_bus.audio, configuration->sound.rate)) != NES_OK) {
+		goto exit;
+	}
+
+	if((result = nes_movie_load(configuration, &g_bus.movie)) != NES_OK) {
+		goto exit;
+	}
+
+	if(configuration->display.pipeline) {
+
+		if((result = nes_video_pipeline_load(&g_bus.video)) != NES_OK) {
+			goto exit;
+		}
+	} else if(configuration->display.band > 1) {
+
+		if((result = nes_video_band_load(&g_bus.video, configuration->display.band)) != NES_OK) {
+			goto exit;
+		}
+	} else if((result = nes_video_surface_load(&g_bus.video)) != NES_OK) {
+		goto exit;
+	}
+
+	if(configuration->replay.rewind && configuration->display.pipeline) {
+		TRACE(LEVEL_WARNING, "%s", "Bus rewind ignored with pipelined rendering");
+	} else if(configuration->replay.rewind) {
+		nes_buffer_t region[BUS_REWIND_MAX] = {
+			{ (uint8_t *)&g_bus.rewind.core, sizeof(g_bus.rewind.core) },
+			g_bus.ram_object,
+			g_bus.ram_processor,
+			g_bus.ram_video,
+			g_bus.ram_video_palette,
+			g_bus.mapper.cartridge.ram[RAM_PROGRAM],
+			g_bus.mapper.cartridge.ram[RAM_CHARACTER],
+			};
+
+		nes_bus_core_save(&g_bus.rewind.core);
+
+		if((result = nes_rewind_load(&g_bus.rewind.ring, region, BUS_REWIND_MAX, configuration->replay.rewind * (size_t)BYTES_PER_MBYTE)) != NES_OK) {
+			goto exit;
+		}
+
+		g_bus.rewind.enabled = true;
+		TRACE(LEVEL_VERBOSE, "Bus rewind: %u MB", configuration->replay.rewind);
+	}
+
 	TRACE(LEVEL_VERBOSE, "%s", "Bus loaded");
 	g_bus.loaded = true;
 
@@ -98,8 +236,17 @@ nes_bus_read(
 					result = g_bus.ram_processor.ptr[(address - PROCESSOR_RAM_BEGIN) % PROCESSOR_RAM_MIRROR];
 					break;
 				case VIDEO_PORT_BEGIN ... VIDEO_PORT_END: /* 0x2000 - 0x3fff */
+					nes_video_synchronize(&g_bus.video, g_bus.cycle);
 					result = nes_video_port_read(&g_bus.video, (address - VIDEO_PORT_BEGIN) % VIDEO_PORT_MIRROR);
 					break;
+				case AUDIO_STATUS: /* 0x4015 */
+					nes_audio_synchronize(&g_bus.audio, g_bus.cycle);
+					result = nes_audio_port_read(&g_bus.audio, address - AUDIO_PORT_BEGIN);
+					break;
+				case INPUT_CONTROLLER_1: /* 0x4016 */
+				case INPUT_CONTROLLER_2: /* 0x4017 */
+					result = nes_input_port_read(&g_bus.input, address - INPUT_CONTROLLER_1);
+					break;
 				case PROCESSOR_WORK_RAM_BEGIN ... PROCESSOR_WORK_RAM_END: /* 0x6000 - 0x7fff */
 					result = nes_mapper_ram_read(&g_bus.mapper, RAM_PROGRAM, address - PROCESSOR_WORK_RAM_BEGIN);
 					break;
@@ -137,11 +284,97 @@ nes_bus_read(
 	return result;
 }
 
+void
+nes_bus_restore(
+	__in const nes_bus_state_t *state
+	)
+{
+	nes_bus_invalidate(state->ram_video, state->ram_cartridge[RAM_CHARACTER].ptr, state->ram_cartridge[RAM_CHARACTER].length);
+
+	for(int type = 0; type < RAM_MAX; ++type) {
+
+		if(state->ram_cartridge[type].ptr) {
+			memcpy(g_bus.mapper.cartridge.ram[type].ptr, state->ram_cartridge[type].ptr, state->ram_cartridge[type].length);
+		}
+	}
+
+	memcpy(g_bus.ram_object.ptr, state->ram_object, sizeof(state->ram_object));
+	memcpy(g_bus.ram_processor.ptr, state->ram_processor, sizeof(state->ram_processor));
+	memcpy(g_bus.ram_video.ptr, state->ram_video, sizeof(state->ram_video));
+	memcpy(g_bus.ram_video_palette.ptr, state->ram_video_palette, sizeof(state->ram_video_palette));
+	nes_bus_core_load(&state->core);
+}
+
+int
+nes_bus_rewind_pop(void)
+{
+	int result;
+
+	if((result = nes_rewind_pop(&g_bus.rewind.ring)) != NES_OK) {
+		goto exit;
+	}
+
+	nes_bus_invalidate(nes_rewind_image(&g_bus.rewind.ring, BUS_REWIND_VIDEO),
+		nes_rewind_image(&g_bus.rewind.ring, BUS_REWIND_CHARACTER), g_bus.mapper.cartridge.ram[RAM_CHARACTER].length);
+	nes_rewind_restore(&g_bus.rewind.ring);
+	nes_bus_core_load(&g_bus.rewind.core);
+
+exit:
+	return result;
+}
+
+void
+nes_bus_rewind_push(void)
+{
+	nes_bus_core_save(&g_bus.rewind.core);
+
+	/* Samples already handed to the service are stale, so zero them to keep the snapshot delta small */
+	memset(g_bus.rewind.core.audio.sample, 0, sizeof(g_bus.rewind.core.audio.sample));
+	memset(&g_bus.rewind.core.audio.resample[g_bus.rewind.core.audio.resample_count], 0,
+		sizeof(g_bus.rewind.core.audio.resample) - (g_bus.rewind.core.audio.resample_count * sizeof(*g_bus.rewind.core.audio.resample)));
+
+	/* Core state and the single-page object and palette RAM change every frame, so always diff them */
+	nes_rewind_invalidate(&g_bus.rewind.ring, BUS_REWIND_CORE);
+	nes_rewind_invalidate(&g_bus.rewind.ring, BUS_REWIND_OBJECT);
+	nes_rewind_invalidate(&g_bus.rewind.ring, BUS_REWIND_VIDEO_PALETTE);
+	nes_rewind_push(&g_bus.rewind.ring);
+}
+
+void
+nes_bus_save(
+	__inout nes_bus_state_t *state
+	)
+{
+
+	for(int type = 0; type < RAM_MAX; ++type) {
+
+		if(state->ram_cartridge[type].ptr) {
+			memcpy(state->ram_cartridge[type].ptr, g_bus.mapper.cartridge.ram[type].ptr, state->ram_cartridge[type].length);
+		}
+	}
+
+	memcpy(state->ram_object, g_bus.ram_object.ptr, sizeof(state->ram_object));
+	memcpy(state->ram_processor, g_bus.ram_processor.ptr, sizeof(state->ram_processor));
+	memcpy(state->ram_video, g_bus.ram_video.ptr, sizeof(state->ram_video));
+	memcpy(state->ram_video_palette, g_bus.ram_video_palette.ptr, sizeof(state->ram_video_palette));
+	nes_bus_core_save(&state->core);
+}
+
 void
 nes_bus_unload(void)
 {
 	TRACE(LEVEL_VERBOSE, "%s", "Bus unloading");
+	nes_video_pipeline_unload(&g_bus.video);
+	nes_video_band_unload(&g_bus.video);
+	nes_video_surface_unload(&g_bus.video);
+	nes_rewind_unload(&g_bus.rewind.ring);
+	nes_movie_unload(&g_bus.movie);
 	nes_mapper_unload(&g_bus.mapper);
+
+	for(int type = 0; type < RAM_MAX; ++type) {
+		nes_buffer_free(&g_bus.state.ram_cartridge[type]);
+	}
+
 	nes_buffer_free(&g_bus.ram_video_palette);
 	nes_buffer_free(&g_bus.ram_video);
 	nes_buffer_free(&g_bus.ram_processor);
@@ -175,15 +408,27 @@ nes_bus_write(
 			switch(address) {
 				case PROCESSOR_RAM_BEGIN ... PROCESSOR_RAM_END: /* 0x0000 - 0x1fff */
 					g_bus.ram_processor.ptr[(address - PROCESSOR_RAM_BEGIN) % PROCESSOR_RAM_MIRROR] = data;
+					nes_rewind_dirty(&g_bus.rewind.ring, BUS_REWIND_PROCESSOR, (address - PROCESSOR_RAM_BEGIN) % PROCESSOR_RAM_MIRROR);
 					break;
 				case VIDEO_PORT_BEGIN ... VIDEO_PORT_END: /* 0x2000 - 0x3fff */
+					nes_video_synchronize(&g_bus.video, g_bus.cycle);
 					nes_video_port_write(&g_bus.video, (address - VIDEO_PORT_BEGIN) % VIDEO_PORT_MIRROR, data);
 					break;
+				case AUDIO_PORT_BEGIN ... AUDIO_PORT_END: /* 0x4000 - 0x4013 */
+				case AUDIO_STATUS: /* 0x4015 */
+				case AUDIO_FRAME: /* 0x4017 */
+					nes_audio_synchronize(&g_bus.audio, g_bus.cycle);
+					nes_audio_port_write(&g_bus.audio, address - AUDIO_PORT_BEGIN, data);
+					break;
 				case PROCESSOR_TRANSFER: /* 0x4014 */
 					nes_processor_transfer(&g_bus.processor, data);
 					break;
+				case INPUT_CONTROLLER_1: /* 0x4016 */
+					nes_input_port_write(&g_bus.input, data);
+					break;
 				case PROCESSOR_WORK_RAM_BEGIN ... PROCESSOR_WORK_RAM_END: /* 0x6000 - 0x7fff */
 					nes_mapper_ram_write(&g_bus.mapper, RAM_PROGRAM, address - PROCESSOR_WORK_RAM_BEGIN, data);
+					nes_rewind_dirty(&g_bus.rewind.ring, BUS_REWIND_PROGRAM, address - PROCESSOR_WORK_RAM_BEGIN);
 					break;
 				case PROCESSOR_ROM_0_BEGIN ... PROCESSOR_ROM_0_END: /* 0x8000 - 0xbfff */
 				case PROCESSOR_ROM_1_BEGIN ... PROCESSOR_ROM_1_END: /* 0xc000 - 0xffff */
@@ -199,9 +444,11 @@ nes_bus_write(
 			switch(address) {
 				case VIDEO_ROM_BEGIN ... VIDEO_ROM_END: /* 0x0000 - 0x1fff */
 					nes_mapper_rom_write(&g_bus.mapper, ROM_CHARACTER, address - VIDEO_ROM_BEGIN, data);
+					nes_rewind_dirty(&g_bus.rewind.ring, BUS_REWIND_CHARACTER, address - VIDEO_ROM_BEGIN);
 					break;
 				case VIDEO_RAM_BEGIN ... VIDEO_RAM_END: /* 0x2000 - 0x3eff */
 					g_bus.ram_video.ptr[(address - VIDEO_RAM_BEGIN) % VIDEO_RAM_MIRROR] = data;
+					nes_rewind_dirty(&g_bus.rewind.ring, BUS_REWIND_VIDEO, (address - VIDEO_RAM_BEGIN) % VIDEO_RAM_MIRROR);
 					break;
 				case VIDEO_PALETTE_RAM_BEGIN ... VIDEO_PALETTE_RAM_END: /* 0x3f00 - 0x3fff */
 					g_bus.ram_video_palette.ptr[(address - VIDEO_PALETTE_RAM_BEGIN) % VIDEO_PALETTE_RAM_MIRROR] = data;
@@ -234,6 +481,16 @@ nes_load(
 	TRACE(LEVEL_VERBOSE, "Configuration rom: %p, %.02f KB (%u bytes)", configuration->rom.data.ptr, configuration->rom.data.length / (float)BYTES_PER_KBYTE,
 		configuration->rom.data.length);
 	TRACE(LEVEL_VERBOSE, "Configuration display: %sx%u", configuration->display.fullscreen ? "Fullscreen" : "Windowed", configuration->display.scale);
+	TRACE(LEVEL_VERBOSE, "Configuration pipeline: %s", configuration->display.pipeline ? "Enabled" : "Disabled");
+	TRACE(LEVEL_VERBOSE, "Configuration band: %u", configuration->display.band);
+	TRACE(LEVEL_VERBOSE, "Configuration run-ahead: %u", configuration->display.runahead);
+	TRACE(LEVEL_VERBOSE, "Configuration filter: %i", configuration->display.filter);
+	TRACE(LEVEL_VERBOSE, "Configuration format: %i", configuration->display.format);
+	TRACE(LEVEL_VERBOSE, "Configuration palette: %p, %zu bytes", configuration->display.palette.ptr, configuration->display.palette.length);
+	TRACE(LEVEL_VERBOSE, "Configuration replay: %i, \"%s\"", configuration->replay.mode, configuration->replay.path);
+	TRACE(LEVEL_VERBOSE, "Configuration rewind: %u MB", configuration->replay.rewind);
+	TRACE(LEVEL_VERBOSE, "Configuration callback: %s%s, %p", configuration->callback.audio ? "Audio " : "", configuration->callback.frame ? "Frame" : "",
+		configuration->callback.context);
 
 	if((result = nes_service_load(configuration)) != NES_OK) {
 		goto exit;
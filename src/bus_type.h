@@ -22,10 +22,25 @@
 #ifndef NES_BUS_TYPE_H_
 #define NES_BUS_TYPE_H_
 
+#include "../include/system/audio.h"
+#include "../include/system/input.h"
 #include "../include/system/processor.h"
 #include "../include/system/video.h"
 #include "../include/service.h"
 
+#define BUS_RUNAHEAD_MAX 4
+
+enum {
+        BUS_REWIND_CORE = 0,
+        BUS_REWIND_OBJECT,
+        BUS_REWIND_PROCESSOR,
+        BUS_REWIND_VIDEO,
+        BUS_REWIND_VIDEO_PALETTE,
+        BUS_REWIND_PROGRAM,
+        BUS_REWIND_CHARACTER,
+        BUS_REWIND_MAX,
+};
+
 #define OBJECT_RAM_WIDTH \
         ADDRESS_WIDTH(OBJECT_RAM_BEGIN, OBJECT_RAM_END)
 
@@ -39,13 +54,45 @@
         ADDRESS_WIDTH(VIDEO_PALETTE_RAM_BEGIN, VIDEO_PALETTE_RAM_BEGIN + VIDEO_PALETTE_RAM_MIRROR - 1)
 
 typedef struct {
+        nes_audio_t audio;
+        uint64_t cycle;
+        nes_input_t input;
+        nes_mapper_t mapper;
+        nes_processor_t processor;
+        nes_video_t video;
+} nes_bus_core_t;
+
+typedef struct {
+        nes_bus_core_t core;
+        nes_buffer_t ram_cartridge[RAM_MAX];
+        uint8_t ram_object[OBJECT_RAM_WIDTH];
+        uint8_t ram_processor[PROCESSOR_RAM_WIDTH];
+        uint8_t ram_video[VIDEO_RAM_WIDTH];
+        uint8_t ram_video_palette[VIDEO_PALETTE_RAM_WIDTH];
+} nes_bus_state_t;
+
+typedef struct {
+        nes_audio_t audio;
+        uint64_t cycle;
+        nes_input_t input;
         bool loaded;
         nes_mapper_t mapper;
+        nes_movie_t movie;
         nes_processor_t processor;
         nes_buffer_t ram_object;
         nes_buffer_t ram_processor;
         nes_buffer_t ram_video;
         nes_buffer_t ram_video_palette;
+
+        struct {
+                nes_bus_core_t core;
+                bool enabled;
+                nes_rewind_t ring;
+        } rewind;
+
+        unsigned runahead;
+        unsigned speed;
+        nes_bus_state_t state;
         nes_video_t video;
 } nes_bus_t;
 
@@ -55,10 +102,36 @@ extern "C" {
 
 nes_bus_t *nes_bus(void);
 
+void nes_bus_core_load(
+	__in const nes_bus_core_t *core
+	);
+
+void nes_bus_core_save(
+	__inout nes_bus_core_t *core
+	);
+
+void nes_bus_invalidate(
+	__in const uint8_t *ram_video,
+	__in const uint8_t *ram_character,
+	__in size_t length
+	);
+
 int nes_bus_load(
 	__in const nes_t *configuration
 	);
 
+void nes_bus_restore(
+	__in const nes_bus_state_t *state
+	);
+
+int nes_bus_rewind_pop(void);
+
+void nes_bus_rewind_push(void);
+
+void nes_bus_save(
+	__inout nes_bus_state_t *state
+	);
+
 void nes_bus_unload(void);
 
 #ifdef __cplusplus
@@ -0,0 +1,436 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./filter_type.h"
+
+#define FILTER_ROW(_ROW_, _SOURCE_, _WIDTH_, _COUNT_) { \
+	(_ROW_)[0] = (_SOURCE_)[0]; \
+	memcpy(&(_ROW_)[1], (_SOURCE_), (_WIDTH_) * sizeof(*(_SOURCE_))); \
+	for(uint32_t _X_ = (_WIDTH_) + 1; _X_ < ((_COUNT_) + 2); ++_X_) { \
+		(_ROW_)[_X_] = (_SOURCE_)[(_WIDTH_) - 1]; \
+	} \
+	}
+
+#define FILTER_ROWS(_ROW_, _INPUT_, _Y_, _WIDTH_, _HEIGHT_, _COUNT_) { \
+	FILTER_ROW((_ROW_)[0], (_INPUT_) + ((((_Y_) > 0) ? ((_Y_) - 1) : (_Y_)) * (_WIDTH_)), _WIDTH_, _COUNT_); \
+	FILTER_ROW((_ROW_)[1], (_INPUT_) + ((_Y_) * (_WIDTH_)), _WIDTH_, _COUNT_); \
+	FILTER_ROW((_ROW_)[2], (_INPUT_) + ((((_Y_) + 1) < (_HEIGHT_)) ? ((_Y_) + 1) : (_Y_)) * (_WIDTH_), _WIDTH_, _COUNT_); \
+	}
+
+#define FILTER_LOAD(_VECTOR_, _ROW_, _X_) \
+	memcpy(&(_VECTOR_), &(_ROW_)[_X_], sizeof(_VECTOR_))
+
+#define FILTER_SELECT(_TYPE_, _MASK_, _TRUE_, _FALSE_) \
+	(((_TRUE_) & (_TYPE_)(_MASK_)) | ((_FALSE_) & ~(_TYPE_)(_MASK_)))
+
+#define FILTER_SCALE2X(_NAME_, _TYPE_, _VECTOR_) \
+void \
+_NAME_( \
+	__in const _TYPE_ *input, \
+	__inout _TYPE_ *output, \
+	__in uint32_t width, \
+	__in uint32_t height \
+	) \
+{ \
+	_TYPE_ row[3][FILTER_WIDTH_MAX + 2 + (FILTER_VECTOR_WIDTH / sizeof(_TYPE_))]; \
+	uint32_t count = ((width + (sizeof(_VECTOR_) / sizeof(_TYPE_)) - 1) / (sizeof(_VECTOR_) / sizeof(_TYPE_))) * (sizeof(_VECTOR_) / sizeof(_TYPE_)); \
+	for(uint32_t y = 0; y < height; ++y) { \
+		_TYPE_ *top = output + (2 * y * 2 * width), *bottom = top + (2 * width); \
+		FILTER_ROWS(row, input, y, width, height, count); \
+		for(uint32_t x = 0; x < count; x += (sizeof(_VECTOR_) / sizeof(_TYPE_))) { \
+			_VECTOR_ b, d, e, f, h, edge, result[4]; \
+			FILTER_LOAD(b, row[0], x + 1); \
+			FILTER_LOAD(d, row[1], x); \
+			FILTER_LOAD(e, row[1], x + 1); \
+			FILTER_LOAD(f, row[1], x + 2); \
+			FILTER_LOAD(h, row[2], x + 1); \
+			edge = (_VECTOR_)((b != h) & (d != f)); \
+			result[0] = FILTER_SELECT(_VECTOR_, edge & (_VECTOR_)(d == b), d, e); \
+			result[1] = FILTER_SELECT(_VECTOR_, edge & (_VECTOR_)(b == f), f, e); \
+			result[2] = FILTER_SELECT(_VECTOR_, edge & (_VECTOR_)(d == h), d, e); \
+			result[3] = FILTER_SELECT(_VECTOR_, edge & (_VECTOR_)(h == f), f, e); \
+			for(uint32_t lane = 0; (lane < (sizeof(_VECTOR_) / sizeof(_TYPE_))) && ((x + lane) < width); ++lane) { \
+				top[2 * (x + lane)] = result[0][lane]; \
+				top[(2 * (x + lane)) + 1] = result[1][lane]; \
+				bottom[2 * (x + lane)] = result[2][lane]; \
+				bottom[(2 * (x + lane)) + 1] = result[3][lane]; \
+			} \
+		} \
+	} \
+}
+
+#define FILTER_SCALE3X(_NAME_, _TYPE_, _VECTOR_) \
+void \
+_NAME_( \
+	__in const _TYPE_ *input, \
+	__inout _TYPE_ *output, \
+	__in uint32_t width, \
+	__in uint32_t height \
+	) \
+{ \
+	_TYPE_ row[3][FILTER_WIDTH_MAX + 2 + (FILTER_VECTOR_WIDTH / sizeof(_TYPE_))]; \
+	uint32_t count = ((width + (sizeof(_VECTOR_) / sizeof(_TYPE_)) - 1) / (sizeof(_VECTOR_) / sizeof(_TYPE_))) * (sizeof(_VECTOR_) / sizeof(_TYPE_)); \
+	for(uint32_t y = 0; y < height; ++y) { \
+		_TYPE_ *top = output + (3 * y * 3 * width), *middle = top + (3 * width), *bottom = middle + (3 * width); \
+		FILTER_ROWS(row, input, y, width, height, count); \
+		for(uint32_t x = 0; x < count; x += (sizeof(_VECTOR_) / sizeof(_TYPE_))) { \
+			_VECTOR_ a, b, c, d, e, f, g, h, i, bf, db, dh, edge, hf, result[9]; \
+			FILTER_LOAD(a, row[0], x); \
+			FILTER_LOAD(b, row[0], x + 1); \
+			FILTER_LOAD(c, row[0], x + 2); \
+			FILTER_LOAD(d, row[1], x); \
+			FILTER_LOAD(e, row[1], x + 1); \
+			FILTER_LOAD(f, row[1], x + 2); \
+			FILTER_LOAD(g, row[2], x); \
+			FILTER_LOAD(h, row[2], x + 1); \
+			FILTER_LOAD(i, row[2], x + 2); \
+			edge = (_VECTOR_)((b != h) & (d != f)); \
+			bf = edge & (_VECTOR_)(b == f); \
+			db = edge & (_VECTOR_)(d == b); \
+			dh = edge & (_VECTOR_)(d == h); \
+			hf = edge & (_VECTOR_)(h == f); \
+			result[0] = FILTER_SELECT(_VECTOR_, db, d, e); \
+			result[1] = FILTER_SELECT(_VECTOR_, (db & (_VECTOR_)(e != c)) | (bf & (_VECTOR_)(e != a)), b, e); \
+			result[2] = FILTER_SELECT(_VECTOR_, bf, f, e); \
+			result[3] = FILTER_SELECT(_VECTOR_, (db & (_VECTOR_)(e != g)) | (dh & (_VECTOR_)(e != a)), d, e); \
+			result[4] = e; \
+			result[5] = FILTER_SELECT(_VECTOR_, (bf & (_VECTOR_)(e != i)) | (hf & (_VECTOR_)(e != c)), f, e); \
+			result[6] = FILTER_SELECT(_VECTOR_, dh, d, e); \
+			result[7] = FILTER_SELECT(_VECTOR_, (dh & (_VECTOR_)(e != i)) | (hf & (_VECTOR_)(e != g)), h, e); \
+			result[8] = FILTER_SELECT(_VECTOR_, hf, f, e); \
+			for(uint32_t lane = 0; (lane < (sizeof(_VECTOR_) / sizeof(_TYPE_))) && ((x + lane) < width); ++lane) { \
+				for(uint32_t column = 0; column < 3; ++column) { \
+					top[(3 * (x + lane)) + column] = result[column][lane]; \
+					middle[(3 * (x + lane)) + column] = result[3 + column][lane]; \
+					bottom[(3 * (x + lane)) + column] = result[6 + column][lane]; \
+				} \
+			} \
+		} \
+	} \
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+static nes_filter_ntsc_t g_filter_ntsc = { .once = ONCE_FLAG_INIT, };
+
+int
+nes_filter(
+	__in int filter,
+	__in int format,
+	__in const void *input,
+	__inout void *output,
+	__in uint32_t width,
+	__in uint32_t height
+	)
+{
+	int result = NES_OK;
+
+	if(!input || !output) {
+		result = ERROR(NES_ERR, "invalid filter buffer -- %p, %p", input, output);
+		goto exit;
+	}
+
+	if(!width || (width > FILTER_WIDTH_MAX) || !height) {
+		result = ERROR(NES_ERR, "invalid filter dimensions -- %ux%u", width, height);
+		goto exit;
+	}
+
+	switch(filter) {
+		case NES_FILTER_NONE:
+
+			switch(format) {
+				case NES_FORMAT_ARGB8888:
+					memcpy(output, input, width * height * sizeof(uint32_t));
+					break;
+				case NES_FORMAT_RGB565:
+					memcpy(output, input, width * height * sizeof(uint16_t));
+					break;
+				case NES_FORMAT_INDEXED8:
+					memcpy(output, input, width * height * sizeof(uint8_t));
+					break;
+				default:
+					result = ERROR(NES_ERR, "unsupported filter format -- %i", format);
+					goto exit;
+			}
+			break;
+		case NES_FILTER_SCALE2X:
+
+			switch(format) {
+				case NES_FORMAT_ARGB8888:
+					nes_filter_scale2x_argb8888(input, output, width, height);
+					break;
+				case NES_FORMAT_INDEXED8:
+					nes_filter_scale2x_indexed8(input, output, width, height);
+					break;
+				default:
+					result = ERROR(NES_ERR, "unsupported filter format -- %i", format);
+					goto exit;
+			}
+			break;
+		case NES_FILTER_SCALE3X:
+
+			switch(format) {
+				case NES_FORMAT_ARGB8888:
+					nes_filter_scale3x_argb8888(input, output, width, height);
+					break;
+				case NES_FORMAT_INDEXED8:
+					nes_filter_scale3x_indexed8(input, output, width, height);
+					break;
+				default:
+					result = ERROR(NES_ERR, "unsupported filter format -- %i", format);
+					goto exit;
+			}
+			break;
+		case NES_FILTER_HQ2X:
+
+			if(format != NES_FORMAT_ARGB8888) {
+				result = ERROR(NES_ERR, "unsupported filter format -- %i", format);
+				goto exit;
+			}
+
+			nes_filter_hq2x(input, output, width, height);
+			break;
+		case NES_FILTER_NTSC:
+
+			if(format != NES_FORMAT_ARGB8888) {
+				result = ERROR(NES_ERR, "unsupported filter format -- %i", format);
+				goto exit;
+			}
+
+			nes_filter_ntsc(input, output, width, height);
+			break;
+		default:
+			result = ERROR(NES_ERR, "unsupported filter -- %i", filter);
+			goto exit;
+	}
+
+exit:
+	return result;
+}
+
+void
+nes_filter_hq2x(
+	__in const uint32_t *input,
+	__inout uint32_t *output,
+	__in uint32_t width,
+	__in uint32_t height
+	)
+{
+	uint32_t row[3][FILTER_WIDTH_MAX + 2 + (FILTER_VECTOR_WIDTH / sizeof(uint32_t))];
+	uint32_t count = ((width + (FILTER_VECTOR_WIDTH / sizeof(uint32_t)) - 1) / (FILTER_VECTOR_WIDTH / sizeof(uint32_t)))
+		* (FILTER_VECTOR_WIDTH / sizeof(uint32_t));
+
+	for(uint32_t y = 0; y < height; ++y) {
+		uint32_t *top = output + (2 * y * 2 * width), *bottom = top + (2 * width);
+
+		FILTER_ROWS(row, input, y, width, height, count);
+
+		for(uint32_t x = 0; x < count; x += (FILTER_VECTOR_WIDTH / sizeof(uint32_t))) {
+			nes_filter_vector_t b, d, e, f, h, result[4];
+			nes_filter_mask_t bf, db, dh, edge, hf;
+
+			FILTER_LOAD(b, row[0], x + 1);
+			FILTER_LOAD(d, row[1], x);
+			FILTER_LOAD(e, row[1], x + 1);
+			FILTER_LOAD(f, row[1], x + 2);
+			FILTER_LOAD(h, row[2], x + 1);
+			edge = nes_filter_hq2x_different(b, h) & nes_filter_hq2x_different(d, f);
+			bf = edge & ~nes_filter_hq2x_different(b, f);
+			db = edge & ~nes_filter_hq2x_different(d, b);
+			dh = edge & ~nes_filter_hq2x_different(d, h);
+			hf = edge & ~nes_filter_hq2x_different(h, f);
+			result[0] = FILTER_SELECT(nes_filter_vector_t, db, nes_filter_hq2x_blend(e, d, b), e);
+			result[1] = FILTER_SELECT(nes_filter_vector_t, bf, nes_filter_hq2x_blend(e, b, f), e);
+			result[2] = FILTER_SELECT(nes_filter_vector_t, dh, nes_filter_hq2x_blend(e, d, h), e);
+			result[3] = FILTER_SELECT(nes_filter_vector_t, hf, nes_filter_hq2x_blend(e, h, f), e);
+
+			for(uint32_t lane = 0; (lane < (FILTER_VECTOR_WIDTH / sizeof(uint32_t))) && ((x + lane) < width); ++lane) {
+				top[2 * (x + lane)] = result[0][lane];
+				top[(2 * (x + lane)) + 1] = result[1][lane];
+				bottom[2 * (x + lane)] = result[2][lane];
+				bottom[(2 * (x + lane)) + 1] = result[3][lane];
+			}
+		}
+	}
+}
+
+nes_filter_vector_t
+nes_filter_hq2x_blend(
+	__in nes_filter_vector_t center,
+	__in nes_filter_vector_t first,
+	__in nes_filter_vector_t second
+	)
+{
+	nes_filter_vector_t high, low;
+
+	low = ((((center & 0x00ff00ff) << 1) + (first & 0x00ff00ff) + (second & 0x00ff00ff)) >> 2) & 0x00ff00ff;
+	high = (((((center >> 8) & 0x00ff00ff) << 1) + ((first >> 8) & 0x00ff00ff) + ((second >> 8) & 0x00ff00ff)) >> 2) & 0x00ff00ff;
+
+	return low | (high << 8);
+}
+
+nes_filter_mask_t
+nes_filter_hq2x_different(
+	__in nes_filter_vector_t first,
+	__in nes_filter_vector_t second
+	)
+{
+	nes_filter_mask_t y, u, v;
+	nes_filter_mask_t red = (nes_filter_mask_t)((first >> 16) & 0xff) - (nes_filter_mask_t)((second >> 16) & 0xff);
+	nes_filter_mask_t green = (nes_filter_mask_t)((first >> 8) & 0xff) - (nes_filter_mask_t)((second >> 8) & 0xff);
+	nes_filter_mask_t blue = (nes_filter_mask_t)(first & 0xff) - (nes_filter_mask_t)(second & 0xff);
+
+	y = (red + green + blue) >> 2;
+	u = (red - blue) >> 2;
+	v = ((2 * green) - red - blue) >> 3;
+
+	return (y > FILTER_HQ_Y) | (y < -FILTER_HQ_Y) | (u > FILTER_HQ_U) | (u < -FILTER_HQ_U) | (v > FILTER_HQ_V) | (v < -FILTER_HQ_V);
+}
+
+void
+nes_filter_ntsc(
+	__in const uint16_t *input,
+	__inout uint32_t *output,
+	__in uint32_t width,
+	__in uint32_t height
+	)
+{
+	uint16_t row[FILTER_WIDTH_MAX + 2];
+	const nes_filter_vector16_t alpha = { 0, 0, 0, FILTER_NTSC_ALPHA, 0, 0, 0, FILTER_NTSC_ALPHA, };
+
+	call_once(&g_filter_ntsc.once, nes_filter_ntsc_initialize);
+
+	for(uint32_t y = 0; y < height; ++y) {
+		uint32_t *top = output + (2 * y * 2 * width), *bottom = top + (2 * width);
+
+		FILTER_ROW(row, input + (y * width), width, width);
+
+		for(uint32_t x = 0; x < width; ++x) {
+			nes_filter_pixel8_t pixel;
+			nes_filter_vector16_t scanline, value;
+			uint32_t sample = (((y * FILTER_NTSC_PHASE_SCANLINE) + (x * FILTER_NTSC_PHASE_PIXEL)) % FILTER_NTSC_PHASE) / FILTER_NTSC_PHASE_SCANLINE;
+
+			value = g_filter_ntsc.kernel[FILTER_NTSC_COLOR(row[x])][sample][0]
+				+ g_filter_ntsc.kernel[FILTER_NTSC_COLOR(row[x + 1])][sample][1]
+				+ g_filter_ntsc.kernel[FILTER_NTSC_COLOR(row[x + 2])][sample][2];
+			value &= (nes_filter_vector16_t)(value > 0);
+			value = FILTER_SELECT(nes_filter_vector16_t, value > (UINT8_MAX << FILTER_NTSC_FRACTION), UINT8_MAX << FILTER_NTSC_FRACTION, value);
+			scanline = value - (value >> 2);
+			pixel = __builtin_convertvector(((value + (1 << (FILTER_NTSC_FRACTION - 1))) >> FILTER_NTSC_FRACTION) | alpha, nes_filter_pixel8_t);
+			memcpy(&top[2 * x], &pixel, sizeof(pixel));
+			pixel = __builtin_convertvector(((scanline + (1 << (FILTER_NTSC_FRACTION - 1))) >> FILTER_NTSC_FRACTION) | alpha, nes_filter_pixel8_t);
+			memcpy(&bottom[2 * x], &pixel, sizeof(pixel));
+		}
+	}
+}
+
+void
+nes_filter_ntsc_initialize(void)
+{
+
+	for(uint16_t color = 0; color < VIDEO_COLOR_GRAYSCALE; ++color) {
+
+		for(int sample = 0; sample < FILTER_NTSC_SAMPLES; ++sample) {
+
+			for(int output = 0; output < 2; ++output) {
+				float yiq[FILTER_NTSC_TAPS][3] = {};
+				int center = (output * (FILTER_NTSC_PHASE_PIXEL / 2)) + (FILTER_NTSC_PHASE_PIXEL / 4);
+
+				for(int offset = center - (FILTER_NTSC_PHASE / 2); offset < center + (FILTER_NTSC_PHASE / 2); ++offset) {
+					int phase = ((sample * FILTER_NTSC_PHASE_SCANLINE) + offset + FILTER_NTSC_PHASE) % FILTER_NTSC_PHASE;
+					int tap = (offset + FILTER_NTSC_PHASE_PIXEL) / FILTER_NTSC_PHASE_PIXEL;
+					float level = nes_filter_ntsc_signal(color, phase) / FILTER_NTSC_PHASE;
+
+					yiq[tap][0] += level;
+					yiq[tap][1] += level * FILTER_NTSC_CHROMA[phase][0];
+					yiq[tap][2] += level * FILTER_NTSC_CHROMA[phase][1];
+				}
+
+				for(int tap = 0; tap < FILTER_NTSC_TAPS; ++tap) {
+
+					for(int channel = 0; channel < 3; ++channel) {
+						float value = (FILTER_NTSC_RGB[channel][0] * yiq[tap][0]) + (FILTER_NTSC_RGB[channel][1] * yiq[tap][1])
+							+ (FILTER_NTSC_RGB[channel][2] * yiq[tap][2]);
+
+						value *= UINT8_MAX << FILTER_NTSC_FRACTION;
+						g_filter_ntsc.kernel[color][sample][tap][(output * 4) + (2 - channel)] = (value < 0.f) ? (value - 0.5f) : (value + 0.5f);
+					}
+				}
+			}
+		}
+	}
+}
+
+float
+nes_filter_ntsc_signal(
+	__in uint16_t color,
+	__in int phase
+	)
+{
+	float result;
+	int emphasis = (color & VIDEO_COLOR_EMPHASIS) >> VIDEO_COLOR_EMPHASIS_SHIFT, hue = color & 0x0f, level = (color >> 4) & 0x03;
+	float high, low;
+
+	if(hue > 13) {
+		level = 1;
+	}
+
+	low = FILTER_NTSC_LEVEL[level];
+	high = FILTER_NTSC_LEVEL[4 + level];
+
+	if(!hue) {
+		low = high;
+	} else if(hue > 12) {
+		high = low;
+	}
+
+	result = FILTER_NTSC_IN_PHASE(hue, phase) ? high : low;
+
+	if(((emphasis & 1) && FILTER_NTSC_IN_PHASE(0, phase))
+			|| ((emphasis & 2) && FILTER_NTSC_IN_PHASE(4, phase))
+			|| ((emphasis & 4) && FILTER_NTSC_IN_PHASE(8, phase))) {
+		result *= FILTER_NTSC_ATTENUATION;
+	}
+
+	return (result - FILTER_NTSC_BLACK) / (FILTER_NTSC_WHITE - FILTER_NTSC_BLACK);
+}
+
+uint32_t
+nes_filter_scale(
+	__in int filter
+	)
+{
+	return ((filter >= 0) && (filter < NES_FILTER_MAX)) ? FILTER_SCALE[filter] : 1;
+}
+
+FILTER_SCALE2X(nes_filter_scale2x_argb8888, uint32_t, nes_filter_vector_t)
+
+FILTER_SCALE2X(nes_filter_scale2x_indexed8, uint8_t, nes_filter_vector8_t)
+
+FILTER_SCALE3X(nes_filter_scale3x_argb8888, uint32_t, nes_filter_vector_t)
+
+FILTER_SCALE3X(nes_filter_scale3x_indexed8, uint8_t, nes_filter_vector8_t)
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
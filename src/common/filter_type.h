@@ -0,0 +1,166 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NES_FILTER_TYPE_H_
+#define NES_FILTER_TYPE_H_
+
+#include <threads.h>
+#include "../../include/common.h"
+
+#define FILTER_HQ_U 0x07
+#define FILTER_HQ_V 0x06
+#define FILTER_HQ_Y 0x30
+
+#define FILTER_NTSC_ALPHA 0xff
+#define FILTER_NTSC_ATTENUATION 0.746f
+#define FILTER_NTSC_BLACK 0.518f
+#define FILTER_NTSC_FRACTION 4
+#define FILTER_NTSC_PHASE 12
+#define FILTER_NTSC_PHASE_PIXEL 8
+#define FILTER_NTSC_PHASE_SCANLINE 4
+#define FILTER_NTSC_SAMPLES 3
+#define FILTER_NTSC_TAPS 3
+#define FILTER_NTSC_WHITE 1.962f
+
+#define FILTER_NTSC_COLOR(_COLOR_) \
+	(((_COLOR_) & VIDEO_COLOR_GRAYSCALE) ? ((_COLOR_) & (VIDEO_COLOR_EMPHASIS | 0x30)) : ((_COLOR_) & (VIDEO_COLOR_EMPHASIS | (VIDEO_COLOR_PALETTE - 1))))
+
+#define FILTER_NTSC_IN_PHASE(_COLOR_, _PHASE_) \
+	((((_COLOR_) + (_PHASE_)) % FILTER_NTSC_PHASE) < (FILTER_NTSC_PHASE / 2))
+
+#define FILTER_VECTOR_WIDTH 16
+
+#define FILTER_WIDTH_MAX 1024
+
+typedef int32_t nes_filter_mask_t __attribute__((vector_size(FILTER_VECTOR_WIDTH)));
+typedef uint32_t nes_filter_vector_t __attribute__((vector_size(FILTER_VECTOR_WIDTH)));
+typedef uint8_t nes_filter_vector8_t __attribute__((vector_size(FILTER_VECTOR_WIDTH)));
+typedef int16_t nes_filter_vector16_t __attribute__((vector_size(FILTER_VECTOR_WIDTH)));
+typedef uint8_t nes_filter_pixel8_t __attribute__((vector_size(FILTER_VECTOR_WIDTH / 2)));
+
+typedef struct {
+	once_flag once;
+	nes_filter_vector16_t kernel[VIDEO_COLOR_GRAYSCALE][FILTER_NTSC_SAMPLES][FILTER_NTSC_TAPS];
+} nes_filter_ntsc_t;
+
+static const float FILTER_NTSC_CHROMA[][2] = {
+	{ -0.453990f, 0.891007f, },
+	{ -0.838671f, 0.544639f, },
+	{ -0.998630f, 0.052336f, },
+	{ -0.891007f, -0.453990f, },
+	{ -0.544639f, -0.838671f, },
+	{ -0.052336f, -0.998630f, },
+	{ 0.453990f, -0.891007f, },
+	{ 0.838671f, -0.544639f, },
+	{ 0.998630f, -0.052336f, },
+	{ 0.891007f, 0.453990f, },
+	{ 0.544639f, 0.838671f, },
+	{ 0.052336f, 0.998630f, },
+	};
+
+static const float FILTER_NTSC_LEVEL[] = {
+	0.350f, 0.518f, 0.962f, 1.550f, /* Signal low */
+	1.094f, 1.506f, 1.962f, 1.962f, /* Signal high */
+	};
+
+static const float FILTER_NTSC_RGB[][3] = {
+	{ 1.f, 0.946882f, 0.623557f, }, /* Red */
+	{ 1.f, -0.274788f, -0.635691f, }, /* Green */
+	{ 1.f, -1.108545f, 1.709007f, }, /* Blue */
+	};
+
+static const uint32_t FILTER_SCALE[] = {
+	1, /* NES_FILTER_NONE */
+	2, /* NES_FILTER_SCALE2X */
+	3, /* NES_FILTER_SCALE3X */
+	2, /* NES_FILTER_HQ2X */
+	2, /* NES_FILTER_NTSC */
+	};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void nes_filter_hq2x(
+	__in const uint32_t *input,
+	__inout uint32_t *output,
+	__in uint32_t width,
+	__in uint32_t height
+	);
+
+nes_filter_vector_t nes_filter_hq2x_blend(
+	__in nes_filter_vector_t center,
+	__in nes_filter_vector_t first,
+	__in nes_filter_vector_t second
+	);
+
+nes_filter_mask_t nes_filter_hq2x_different(
+	__in nes_filter_vector_t first,
+	__in nes_filter_vector_t second
+	);
+
+void nes_filter_ntsc(
+	__in const uint16_t *input,
+	__inout uint32_t *output,
+	__in uint32_t width,
+	__in uint32_t height
+	);
+
+void nes_filter_ntsc_initialize(void);
+
+float nes_filter_ntsc_signal(
+	__in uint16_t color,
+	__in int phase
+	);
+
+void nes_filter_scale2x_argb8888(
+	__in const uint32_t *input,
+	__inout uint32_t *output,
+	__in uint32_t width,
+	__in uint32_t height
+	);
+
+void nes_filter_scale2x_indexed8(
+	__in const uint8_t *input,
+	__inout uint8_t *output,
+	__in uint32_t width,
+	__in uint32_t height
+	);
+
+void nes_filter_scale3x_argb8888(
+	__in const uint32_t *input,
+	__inout uint32_t *output,
+	__in uint32_t width,
+	__in uint32_t height
+	);
+
+void nes_filter_scale3x_indexed8(
+	__in const uint8_t *input,
+	__inout uint8_t *output,
+	__in uint32_t width,
+	__in uint32_t height
+	);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NES_FILTER_TYPE_H_ */
@@ -0,0 +1,391 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./movie_type.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+int
+nes_movie_decode(
+	__inout nes_movie_t *movie
+	)
+{
+	int result = NES_OK;
+
+	if(movie->offset >= movie->data.length) {
+		TRACE(LEVEL_INFORMATION, "Movie playback complete: %lu frames", movie->frame);
+		result = NES_EVT;
+		goto exit;
+	}
+
+	for(uint32_t shift = 0; shift < (MOVIE_RUN_WIDTH * MOVIE_RUN_SHIFT); shift += MOVIE_RUN_SHIFT) {
+		uint8_t data;
+
+		if(movie->offset >= movie->data.length) {
+			break;
+		}
+
+		data = movie->data.ptr[movie->offset++];
+		movie->run |= (uint32_t)(data & MOVIE_RUN_MASK) << shift;
+
+		if(!(data & MOVIE_RUN_CONTINUE)) {
+			break;
+		}
+	}
+
+	if(!movie->run || ((movie->offset + sizeof(movie->state)) > movie->data.length)) {
+		result = ERROR(NES_ERR, "movie malformed -- offset %zu", movie->offset);
+		goto exit;
+	}
+
+	memcpy(movie->state, movie->data.ptr + movie->offset, sizeof(movie->state));
+	movie->offset += sizeof(movie->state);
+
+exit:
+	return result;
+}
+
+int
+nes_movie_encode(
+	__inout nes_movie_t *movie
+	)
+{
+	size_t length = 0;
+	int result = NES_OK;
+	uint8_t data[MOVIE_RUN_WIDTH + NES_CONTROLLER_MAX];
+
+	do {
+		data[length] = movie->run & MOVIE_RUN_MASK;
+
+		if(movie->run >>= MOVIE_RUN_SHIFT) {
+			data[length] |= MOVIE_RUN_CONTINUE;
+		}
+
+		++length;
+	} while(movie->run);
+
+	memcpy(data + length, movie->state, sizeof(movie->state));
+	length += sizeof(movie->state);
+
+	if(fwrite(data, sizeof(uint8_t), length, movie->file) != length) {
+		result = ERROR(NES_ERR, "movie write error -- frame %lu", movie->frame);
+		goto exit;
+	}
+
+exit:
+	return result;
+}
+
+int
+nes_movie_frame(
+	__inout nes_movie_t *movie,
+	__inout uint8_t *state
+	)
+{
+	int result = NES_OK;
+
+	switch(movie->mode) {
+		case NES_REPLAY_PLAYBACK:
+
+			if(!movie->run && ((result = nes_movie_decode(movie)) != NES_OK)) {
+				goto exit;
+			}
+
+			memcpy(state, movie->state, sizeof(movie->state));
+			--movie->run;
+			break;
+		case NES_REPLAY_RECORD:
+
+			if(movie->run && (movie->run < UINT32_MAX) && !memcmp(state, movie->state, sizeof(movie->state))) {
+				++movie->run;
+				break;
+			}
+
+			if(movie->run && ((result = nes_movie_encode(movie)) != NES_OK)) {
+				goto exit;
+			}
+
+			memcpy(movie->state, state, sizeof(movie->state));
+			movie->run = 1;
+			break;
+		default:
+			goto exit;
+	}
+
+	++movie->frame;
+
+exit:
+	return result;
+}
+
+void
+nes_movie_hash(
+	__in const nes_buffer_t *data,
+	__inout uint8_t *hash
+	)
+{
+	size_t offset = 0, remaining;
+	uint8_t block[MOVIE_HASH_BLOCK * 2] = {};
+	uint64_t length = (uint64_t)data->length * CHAR_BIT;
+	uint32_t state[MOVIE_HASH_WIDTH / sizeof(uint32_t)];
+
+	memcpy(state, MOVIE_HASH_INITIAL, sizeof(state));
+
+	for(; (offset + MOVIE_HASH_BLOCK) <= data->length; offset += MOVIE_HASH_BLOCK) {
+		nes_movie_hash_block(state, data->ptr + offset);
+	}
+
+	if((remaining = data->length - offset)) {
+		memcpy(block, data->ptr + offset, remaining);
+	}
+
+	block[remaining++] = 0x80;
+	remaining = (remaining > (MOVIE_HASH_BLOCK - sizeof(length))) ? (MOVIE_HASH_BLOCK * 2) : MOVIE_HASH_BLOCK;
+
+	for(size_t index = 0; index < sizeof(length); ++index) {
+		block[remaining - index - 1] = length >> (index * CHAR_BIT);
+	}
+
+	for(offset = 0; offset < remaining; offset += MOVIE_HASH_BLOCK) {
+		nes_movie_hash_block(state, block + offset);
+	}
+
+	for(size_t index = 0; index < MOVIE_HASH_WIDTH; ++index) {
+		hash[index] = state[index / sizeof(uint32_t)] >> ((sizeof(uint32_t) - (index % sizeof(uint32_t)) - 1) * CHAR_BIT);
+	}
+}
+
+void
+nes_movie_hash_block(
+	__inout uint32_t *state,
+	__in const uint8_t *block
+	)
+{
+	uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4], word[80];
+
+	for(int index = 0; index < 16; ++index) {
+		word[index] = ((uint32_t)block[index * 4] << 24) | ((uint32_t)block[(index * 4) + 1] << 16)
+				| ((uint32_t)block[(index * 4) + 2] << 8) | block[(index * 4) + 3];
+	}
+
+	for(int index = 16; index < 80; ++index) {
+		word[index] = MOVIE_ROTATE(word[index - 3] ^ word[index - 8] ^ word[index - 14] ^ word[index - 16], 1);
+	}
+
+	for(int index = 0; index < 80; ++index) {
+		uint32_t function, temp;
+
+		switch(index / 20) {
+			case 0:
+				function = (b & c) | (~b & d);
+				break;
+			case 2:
+				function = (b & c) | (b & d) | (c & d);
+				break;
+			default:
+				function = b ^ c ^ d;
+				break;
+		}
+
+		temp = MOVIE_ROTATE(a, 5) + function + e + MOVIE_HASH_ROUND[index / 20] + word[index];
+		e = d;
+		d = c;
+		c = MOVIE_ROTATE(b, 30);
+		b = a;
+		a = temp;
+	}
+
+	state[0] += a;
+	state[1] += b;
+	state[2] += c;
+	state[3] += d;
+	state[4] += e;
+}
+
+void
+nes_movie_header(
+	__in const nes_t *configuration,
+	__inout nes_movie_header_t *header
+	)
+{
+	const nes_version_t *version = nes_version();
+
+	memset(header, 0, sizeof(*header));
+	memcpy(header->magic, MOVIE_MAGIC, sizeof(header->magic));
+	header->version[0] = version->major;
+	header->version[1] = version->minor;
+	header->version[2] = version->patch;
+	header->controllers = NES_CONTROLLER_MAX;
+	nes_movie_hash(&configuration->rom.data, header->hash);
+}
+
+int
+nes_movie_load(
+	__in const nes_t *configuration,
+	__inout nes_movie_t *movie
+	)
+{
+	int result = NES_OK;
+
+	memset(movie, 0, sizeof(*movie));
+
+	switch(configuration->replay.mode) {
+		case NES_REPLAY_NONE:
+			break;
+		case NES_REPLAY_PLAYBACK:
+			result = nes_movie_playback(configuration, movie);
+			break;
+		case NES_REPLAY_RECORD:
+			result = nes_movie_record(configuration, movie);
+			break;
+		default:
+			result = ERROR(NES_ERR, "movie mode unsupported -- %i", configuration->replay.mode);
+			break;
+	}
+
+	return result;
+}
+
+int
+nes_movie_playback(
+	__in const nes_t *configuration,
+	__inout nes_movie_t *movie
+	)
+{
+	long length;
+	int result = NES_OK;
+	nes_movie_header_t expected, header;
+
+	TRACE(LEVEL_VERBOSE, "Movie playback: \"%s\"", configuration->replay.path);
+
+	if(!configuration->replay.path || !(movie->file = fopen(configuration->replay.path, "rb"))) {
+		result = ERROR(NES_ERR, "movie not found -- %s", configuration->replay.path);
+		goto exit;
+	}
+
+	fseek(movie->file, 0, SEEK_END);
+	length = ftell(movie->file);
+	fseek(movie->file, 0, SEEK_SET);
+
+	if((length < (long)sizeof(header)) || (fread(&header, sizeof(header), 1, movie->file) != 1)) {
+		result = ERROR(NES_ERR, "movie is too small -- expecting %zu bytes", sizeof(header));
+		goto exit;
+	}
+
+	nes_movie_header(configuration, &expected);
+
+	if(memcmp(header.magic, expected.magic, sizeof(header.magic))) {
+		result = ERROR(NES_ERR, "movie magic mismatch -- expecting \"%s\"", MOVIE_MAGIC);
+		goto exit;
+	}
+
+	if(header.controllers != expected.controllers) {
+		result = ERROR(NES_ERR, "movie controllers mismatch -- expecting %u", expected.controllers);
+		goto exit;
+	}
+
+	if(memcmp(header.hash, expected.hash, sizeof(header.hash))) {
+		result = ERROR(NES_ERR, "movie rom mismatch -- %s", configuration->rom.path);
+		goto exit;
+	}
+
+	if(memcmp(header.version, expected.version, sizeof(header.version))) {
+		TRACE(LEVEL_WARNING, "Movie version mismatch: %u.%u.%u", header.version[0], header.version[1], header.version[2]);
+	}
+
+	if((length -= sizeof(header)) > 0) {
+
+		if((result = nes_buffer_allocate(&movie->data, length, 0)) != NES_OK) {
+			goto exit;
+		}
+
+		if(fread(movie->data.ptr, sizeof(uint8_t), movie->data.length, movie->file) != movie->data.length) {
+			result = ERROR(NES_ERR, "movie read error -- %s", configuration->replay.path);
+			goto exit;
+		}
+	}
+
+	movie->mode = NES_REPLAY_PLAYBACK;
+
+exit:
+
+	if(movie->file) {
+		fclose(movie->file);
+		movie->file = NULL;
+	}
+
+	return result;
+}
+
+int
+nes_movie_record(
+	__in const nes_t *configuration,
+	__inout nes_movie_t *movie
+	)
+{
+	int result = NES_OK;
+	nes_movie_header_t header;
+
+	TRACE(LEVEL_VERBOSE, "Movie record: \"%s\"", configuration->replay.path);
+
+	if(!configuration->replay.path || !(movie->file = fopen(configuration->replay.path, "wb"))) {
+		result = ERROR(NES_ERR, "movie create failed -- %s", configuration->replay.path);
+		goto exit;
+	}
+
+	nes_movie_header(configuration, &header);
+
+	if(fwrite(&header, sizeof(header), 1, movie->file) != 1) {
+		result = ERROR(NES_ERR, "movie write error -- %s", configuration->replay.path);
+		goto exit;
+	}
+
+	movie->mode = NES_REPLAY_RECORD;
+
+exit:
+	return result;
+}
+
+void
+nes_movie_unload(
+	__inout nes_movie_t *movie
+	)
+{
+
+	if(movie->file) {
+
+		if(movie->run) {
+			nes_movie_encode(movie);
+		}
+
+		fclose(movie->file);
+		TRACE(LEVEL_VERBOSE, "Movie recorded: %lu frames", movie->frame);
+	}
+
+	nes_buffer_free(&movie->data);
+	memset(movie, 0, sizeof(*movie));
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,97 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NES_MOVIE_TYPE_H_
+#define NES_MOVIE_TYPE_H_
+
+#include "../../include/common.h"
+#include "../../include/common/movie.h"
+
+#define MOVIE_HASH_BLOCK 64
+#define MOVIE_HASH_WIDTH 20
+
+#define MOVIE_MAGIC "NESM"
+
+#define MOVIE_RUN_CONTINUE 0x80
+#define MOVIE_RUN_MASK 0x7f
+#define MOVIE_RUN_SHIFT 7
+#define MOVIE_RUN_WIDTH 5
+
+#define MOVIE_ROTATE(_VALUE_, _SHIFT_) \
+	(((_VALUE_) << (_SHIFT_)) | ((_VALUE_) >> (32 - (_SHIFT_))))
+
+typedef struct {
+	uint8_t magic[4]; /* Magic string */
+	uint8_t version[3]; /* Library version (major, minor, patch) */
+	uint8_t controllers; /* Controllers per frame */
+	uint8_t hash[MOVIE_HASH_WIDTH]; /* ROM SHA-1 digest */
+} nes_movie_header_t;
+
+static const uint32_t MOVIE_HASH_INITIAL[] = {
+	0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0,
+	};
+
+static const uint32_t MOVIE_HASH_ROUND[] = {
+	0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xca62c1d6,
+	};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+int nes_movie_decode(
+	__inout nes_movie_t *movie
+	);
+
+int nes_movie_encode(
+	__inout nes_movie_t *movie
+	);
+
+void nes_movie_hash(
+	__in const nes_buffer_t *data,
+	__inout uint8_t *hash
+	);
+
+void nes_movie_hash_block(
+	__inout uint32_t *state,
+	__in const uint8_t *block
+	);
+
+void nes_movie_header(
+	__in const nes_t *configuration,
+	__inout nes_movie_header_t *header
+	);
+
+int nes_movie_playback(
+	__in const nes_t *configuration,
+	__inout nes_movie_t *movie
+	);
+
+int nes_movie_record(
+	__in const nes_t *configuration,
+	__inout nes_movie_t *movie
+	);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NES_MOVIE_TYPE_H_ */
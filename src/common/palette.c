@@ -0,0 +1,91 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./palette_type.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+int
+nes_palette_load(
+	__inout nes_palette_t *palette,
+	__in const nes_buffer_t *data
+	)
+{
+	int result = NES_OK;
+	uint16_t count = VIDEO_COLOR_PALETTE;
+
+	if(data->length) {
+
+		if((data->length != (VIDEO_COLOR_PALETTE * PALETTE_CHANNELS)) && (data->length != (VIDEO_COLOR_GRAYSCALE * PALETTE_CHANNELS))) {
+			result = ERROR(NES_ERR, "palette length mismatch -- expecting %u or %u bytes, found %zu bytes",
+				VIDEO_COLOR_PALETTE * PALETTE_CHANNELS, VIDEO_COLOR_GRAYSCALE * PALETTE_CHANNELS, data->length);
+			goto exit;
+		}
+
+		count = data->length / PALETTE_CHANNELS;
+
+		for(uint16_t index = 0; index < count; ++index) {
+			const uint8_t *channel = &data->ptr[index * PALETTE_CHANNELS];
+
+			palette->color[index].red = channel[0];
+			palette->color[index].green = channel[1];
+			palette->color[index].blue = channel[2];
+			palette->color[index].alpha = UINT8_MAX;
+		}
+	} else {
+		memcpy(palette->color, PALETTE, sizeof(PALETTE));
+	}
+
+	for(uint16_t index = count; index < VIDEO_COLOR_GRAYSCALE; ++index) {
+		uint8_t emphasis = index >> VIDEO_COLOR_EMPHASIS_SHIFT;
+		nes_color_t *color = &palette->color[index];
+
+		color->raw = palette->color[index % VIDEO_COLOR_PALETTE].raw;
+
+		if((index & 0x0f) < 0x0e) {
+			color->red *= PALETTE_ATTENUATION_SCALE[__builtin_popcount(emphasis & 6)];
+			color->green *= PALETTE_ATTENUATION_SCALE[__builtin_popcount(emphasis & 5)];
+			color->blue *= PALETTE_ATTENUATION_SCALE[__builtin_popcount(emphasis & 3)];
+		}
+	}
+
+	for(uint16_t index = 0; index < VIDEO_COLOR_GRAYSCALE; ++index) {
+		palette->color[VIDEO_COLOR_GRAYSCALE | index].raw = palette->color[index & (VIDEO_COLOR_EMPHASIS | 0x30)].raw;
+	}
+
+	for(uint16_t index = 0; index < VIDEO_COLOR_MAX; ++index) {
+		const nes_color_t *color = &palette->color[index];
+
+		palette->indexed[index] = index & ((index & VIDEO_COLOR_GRAYSCALE) ? 0x30 : (VIDEO_COLOR_PALETTE - 1));
+		palette->rgb565[index] = ((color->red >> 3) << 11) | ((color->green >> 2) << 5) | (color->blue >> 3);
+	}
+
+	TRACE(LEVEL_VERBOSE, "Palette loaded: %s (%u colors)", data->length ? "Custom" : "Default", count);
+
+exit:
+	return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
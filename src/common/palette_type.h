@@ -0,0 +1,111 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NES_PALETTE_TYPE_H_
+#define NES_PALETTE_TYPE_H_
+
+#include "../../include/common.h"
+#include "../../include/common/palette.h"
+
+#define PALETTE_ATTENUATION 0.816328f
+#define PALETTE_CHANNELS 3
+
+/* Indexed by the number of emphasis bits set for the other two channels */
+static const float PALETTE_ATTENUATION_SCALE[] = {
+        1.f, PALETTE_ATTENUATION, PALETTE_ATTENUATION * PALETTE_ATTENUATION,
+        };
+
+static const nes_color_t PALETTE[] = {
+        /* 0x00 */
+        {{ 0x7c, 0x7c, 0x7c, 0xff }},
+        {{ 0xfc, 0x00, 0x00, 0xff }},
+        {{ 0xbc, 0x00, 0x00, 0xff }},
+        {{ 0xbc, 0x28, 0x44, 0xff }},
+        {{ 0x84, 0x00, 0x94, 0xff }},
+        {{ 0x20, 0x00, 0xa8, 0xff }},
+        {{ 0x00, 0x10, 0xa8, 0xff }},
+        {{ 0x00, 0x14, 0x88, 0xff }},
+        /* 0x08 */
+        {{ 0x00, 0x30, 0x50, 0xff }},
+        {{ 0x00, 0x78, 0x00, 0xff }},
+        {{ 0x00, 0x68, 0x00, 0xff }},
+        {{ 0x00, 0x58, 0x00, 0xff }},
+        {{ 0x58, 0x40, 0x00, 0xff }},
+        {{ 0x00, 0x00, 0x00, 0xff }},
+        {{ 0x00, 0x00, 0x00, 0xff }},
+        {{ 0x00, 0x00, 0x00, 0xff }},
+        /* 0x10 */
+        {{ 0xbc, 0xbc, 0xbc, 0xff }},
+        {{ 0xf8, 0x78, 0x00, 0xff }},
+        {{ 0xf8, 0x58, 0x00, 0xff }},
+        {{ 0xfc, 0x44, 0x68, 0xff }},
+        {{ 0xcc, 0x00, 0xd8, 0xff }},
+        {{ 0x58, 0x00, 0xe4, 0xff }},
+        {{ 0x00, 0x38, 0xf8, 0xff }},
+        {{ 0x10, 0x5c, 0xe4, 0xff }},
+        /* 0x18 */
+        {{ 0x00, 0x7c, 0xac, 0xff }},
+        {{ 0x00, 0xb8, 0x00, 0xff }},
+        {{ 0x00, 0xa8, 0x00, 0xff }},
+        {{ 0x44, 0xa8, 0x00, 0xff }},
+        {{ 0x88, 0x88, 0x00, 0xff }},
+        {{ 0x00, 0x00, 0x00, 0xff }},
+        {{ 0x00, 0x00, 0x00, 0xff }},
+        {{ 0x00, 0x00, 0x00, 0xff }},
+        /* 0x20 */
+        {{ 0xf8, 0xf8, 0xf8, 0xff }},
+        {{ 0xfc, 0xbc, 0x5d, 0xff }},
+        {{ 0xfc, 0x88, 0x68, 0xff }},
+        {{ 0xf8, 0x78, 0x98, 0xff }},
+        {{ 0xf8, 0x78, 0xf8, 0xff }},
+        {{ 0x98, 0x58, 0xf8, 0xff }},
+        {{ 0x58, 0x78, 0xf8, 0xff }},
+        {{ 0x44, 0xa0, 0xfc, 0xff }},
+        /* 0x28 */
+        {{ 0x00, 0xb8, 0xf8, 0xff }},
+        {{ 0x18, 0xf8, 0xb8, 0xff }},
+        {{ 0x56, 0xd8, 0x58, 0xff }},
+        {{ 0x98, 0xf8, 0x58, 0xff }},
+        {{ 0xd8, 0xe8, 0x00, 0xff }},
+        {{ 0x78, 0x78, 0x78, 0xff }},
+        {{ 0x00, 0x00, 0x00, 0xff }},
+        {{ 0x00, 0x00, 0x00, 0xff }},
+        /* 0x30 */
+        {{ 0xfc, 0xfc, 0xfc, 0xff }},
+        {{ 0xfc, 0xdf, 0xbc, 0xff }},
+        {{ 0xf8, 0xb8, 0xb8, 0xff }},
+        {{ 0xf8, 0xb8, 0xd8, 0xff }},
+        {{ 0xf8, 0xb8, 0xf8, 0xff }},
+        {{ 0xe5, 0xcc, 0xf8, 0xff }},
+        {{ 0xca, 0xcf, 0xf8, 0xff }},
+        {{ 0xb4, 0xd5, 0xf8, 0xff }},
+        /* 0x38 */
+        {{ 0x78, 0xd8, 0xf8, 0xff }},
+        {{ 0x78, 0xf8, 0xd8, 0xff }},
+        {{ 0xb8, 0xf8, 0xb8, 0xff }},
+        {{ 0xd8, 0xf8, 0xb8, 0xff }},
+        {{ 0xfc, 0xfc, 0x00, 0xff }},
+        {{ 0xb6, 0xb6, 0xb6, 0xff }},
+        {{ 0x00, 0x00, 0x00, 0xff }},
+        {{ 0x00, 0x00, 0x00, 0xff }},
+        };
+
+#endif /* NES_PALETTE_TYPE_H_ */
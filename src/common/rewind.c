@@ -0,0 +1,361 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./rewind_type.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void
+nes_rewind_decode(
+	__inout uint8_t *current,
+	__in const uint8_t *data,
+	__in size_t length
+	)
+{
+
+	for(size_t index = 0, offset = 0; offset < length;) {
+		uint8_t token = data[offset++];
+		size_t run = (token & (REWIND_RUN_MAX - 1)) + 1;
+
+		if(token & REWIND_RUN_LITERAL) {
+
+			for(; run; --run) {
+				current[index++] ^= data[offset++];
+			}
+		} else {
+			index += run;
+		}
+	}
+}
+
+void
+nes_rewind_dirty(
+	__inout nes_rewind_t *rewind,
+	__in int region,
+	__in size_t offset
+	)
+{
+
+	if(rewind->dirty.ptr && (offset < rewind->region[region].length)) {
+		rewind->dirty.ptr[rewind->page[region] + (offset / PAGE_WIDTH)] = true;
+	}
+}
+
+size_t
+nes_rewind_encode(
+	__inout uint8_t *current,
+	__in const uint8_t *live,
+	__in size_t width,
+	__inout uint8_t *data
+	)
+{
+	size_t index = 0, length = 0, result = 0;
+
+	if(!memcmp(current, live, width)) {
+		goto exit;
+	}
+
+	while(index < width) {
+		size_t run = 0;
+
+		while(((index + run) < width) && (run < REWIND_RUN_MAX) && (current[index + run] == live[index + run])) {
+			++run;
+		}
+
+		if(run) {
+			data[length++] = run - 1;
+			index += run;
+			continue;
+		}
+
+		while(((index + run) < width) && (run < REWIND_RUN_MAX) && (current[index + run] != live[index + run])) {
+			++run;
+		}
+
+		data[length++] = REWIND_RUN_LITERAL | (run - 1);
+
+		for(; run; --run, ++index) {
+			data[length++] = current[index] ^ live[index];
+			current[index] = live[index];
+		}
+
+		result = length;
+	}
+
+exit:
+	return result;
+}
+
+const uint8_t *
+nes_rewind_image(
+	__in const nes_rewind_t *rewind,
+	__in int region
+	)
+{
+	return rewind->current.ptr + (rewind->page[region] * PAGE_WIDTH);
+}
+
+void
+nes_rewind_invalidate(
+	__inout nes_rewind_t *rewind,
+	__in int region
+	)
+{
+
+	if(rewind->dirty.ptr) {
+		memset(rewind->dirty.ptr + rewind->page[region], true, rewind->page[region + 1] - rewind->page[region]);
+	}
+}
+
+int
+nes_rewind_load(
+	__inout nes_rewind_t *rewind,
+	__in const nes_buffer_t *region,
+	__in size_t count,
+	__in size_t capacity
+	)
+{
+	size_t pages = 0;
+	int result = NES_OK;
+
+	TRACE(LEVEL_VERBOSE, "%s", "Rewind loading");
+
+	if(!capacity) {
+		result = ERROR(NES_ERR, "invalid rewind capacity -- %zu", capacity);
+		goto exit;
+	}
+
+	if(!count || (count > REWIND_REGION_MAX)) {
+		result = ERROR(NES_ERR, "invalid rewind region count -- %zu (expecting 1-%u)", count, REWIND_REGION_MAX);
+		goto exit;
+	}
+
+	for(size_t index = 0; index < count; ++index) {
+		rewind->page[index] = pages;
+		rewind->region[index] = region[index];
+		pages += (region[index].length + (PAGE_WIDTH - 1)) / PAGE_WIDTH;
+	}
+
+	if(!pages || (pages > (UINT16_MAX + 1))) {
+		result = ERROR(NES_ERR, "invalid rewind page count -- %zu (expecting 1-%u)", pages, UINT16_MAX + 1);
+		goto exit;
+	}
+
+	rewind->page[count] = pages;
+	rewind->region_count = count;
+
+	if((result = nes_buffer_allocate(&rewind->current, pages * PAGE_WIDTH, 0)) != NES_OK) {
+		goto exit;
+	}
+
+	if((result = nes_buffer_allocate(&rewind->data, capacity, 0)) != NES_OK) {
+		goto exit;
+	}
+
+	if((result = nes_buffer_allocate(&rewind->dirty, pages, false)) != NES_OK) {
+		goto exit;
+	}
+
+	/* Worst case alternates changed and unchanged bytes, costing three bytes for every two */
+	if((result = nes_buffer_allocate(&rewind->scratch, (2 * REWIND_RECORD_HEADER) + (pages * (REWIND_PAGE_HEADER + ((PAGE_WIDTH * 3) / 2))),
+			0)) != NES_OK) {
+		goto exit;
+	}
+
+	for(size_t index = 0; index < count; ++index) {
+
+		if(region[index].length) {
+			memcpy(rewind->current.ptr + (rewind->page[index] * PAGE_WIDTH), region[index].ptr, region[index].length);
+		}
+	}
+
+	TRACE(LEVEL_VERBOSE, "Rewind loaded: %zu regions, %zu pages, %.02f KB", count, pages, capacity / (float)BYTES_PER_KBYTE);
+
+exit:
+	return result;
+}
+
+int
+nes_rewind_pop(
+	__inout nes_rewind_t *rewind
+	)
+{
+	uint32_t size;
+	int result = NES_OK;
+
+	if(!rewind->count) {
+		result = NES_EVT;
+		goto exit;
+	}
+
+	nes_rewind_read(rewind, (rewind->head + rewind->data.length - REWIND_RECORD_HEADER) % rewind->data.length, &size, sizeof(size));
+	rewind->head = (rewind->head + rewind->data.length - (size + (2 * REWIND_RECORD_HEADER))) % rewind->data.length;
+	rewind->length -= size + (2 * REWIND_RECORD_HEADER);
+	--rewind->count;
+	nes_rewind_read(rewind, (rewind->head + REWIND_RECORD_HEADER) % rewind->data.length, rewind->scratch.ptr, size);
+
+	for(size_t offset = 0; offset < size;) {
+		uint16_t header[2];
+
+		memcpy(header, rewind->scratch.ptr + offset, sizeof(header));
+		offset += REWIND_PAGE_HEADER;
+		nes_rewind_decode(rewind->current.ptr + (header[0] * PAGE_WIDTH), rewind->scratch.ptr + offset, header[1]);
+		offset += header[1];
+	}
+
+exit:
+	return result;
+}
+
+void
+nes_rewind_push(
+	__inout nes_rewind_t *rewind
+	)
+{
+	uint32_t size;
+	size_t length = REWIND_RECORD_HEADER;
+
+	for(size_t index = 0; index < rewind->region_count; ++index) {
+		const nes_buffer_t *region = &rewind->region[index];
+
+		for(size_t page = rewind->page[index]; page < rewind->page[index + 1]; ++page) {
+			uint16_t header[2];
+			size_t offset = (page - rewind->page[index]) * PAGE_WIDTH, width = region->length - offset;
+
+			if(!rewind->dirty.ptr[page]) {
+				continue;
+			}
+
+			rewind->dirty.ptr[page] = false;
+
+			if((header[1] = nes_rewind_encode(rewind->current.ptr + (page * PAGE_WIDTH), region->ptr + offset,
+					(width > PAGE_WIDTH) ? PAGE_WIDTH : width, rewind->scratch.ptr + length + REWIND_PAGE_HEADER))) {
+				header[0] = page;
+				memcpy(rewind->scratch.ptr + length, header, sizeof(header));
+				length += REWIND_PAGE_HEADER + header[1];
+			}
+		}
+	}
+
+	size = length - REWIND_RECORD_HEADER;
+	memcpy(rewind->scratch.ptr, &size, sizeof(size));
+	memcpy(rewind->scratch.ptr + length, &size, sizeof(size));
+	length += REWIND_RECORD_HEADER;
+
+	if(length > rewind->data.length) {
+		TRACE(LEVEL_WARNING, "Rewind record too large: %zu bytes", length);
+		rewind->count = 0;
+		rewind->head = 0;
+		rewind->length = 0;
+		rewind->tail = 0;
+		return;
+	}
+
+	while((rewind->data.length - rewind->length) < length) {
+		nes_rewind_read(rewind, rewind->tail, &size, sizeof(size));
+		size += 2 * REWIND_RECORD_HEADER;
+		rewind->tail = (rewind->tail + size) % rewind->data.length;
+		rewind->length -= size;
+		--rewind->count;
+	}
+
+	nes_rewind_write(rewind, rewind->head, rewind->scratch.ptr, length);
+	rewind->head = (rewind->head + length) % rewind->data.length;
+	rewind->length += length;
+	++rewind->count;
+}
+
+void
+nes_rewind_read(
+	__in const nes_rewind_t *rewind,
+	__in size_t offset,
+	__inout void *data,
+	__in size_t length
+	)
+{
+	size_t first = rewind->data.length - offset;
+
+	if(first > length) {
+		first = length;
+	}
+
+	memcpy(data, rewind->data.ptr + offset, first);
+	memcpy((uint8_t *)data + first, rewind->data.ptr, length - first);
+}
+
+void
+nes_rewind_restore(
+	__inout nes_rewind_t *rewind
+	)
+{
+
+	for(size_t index = 0; index < rewind->region_count; ++index) {
+
+		if(rewind->region[index].length) {
+			memcpy(rewind->region[index].ptr, nes_rewind_image(rewind, index), rewind->region[index].length);
+		}
+	}
+
+	memset(rewind->dirty.ptr, false, rewind->dirty.length);
+}
+
+void
+nes_rewind_unload(
+	__inout nes_rewind_t *rewind
+	)
+{
+
+	if(!rewind->current.ptr) {
+		return;
+	}
+
+	TRACE(LEVEL_VERBOSE, "%s", "Rewind unloading");
+	nes_buffer_free(&rewind->scratch);
+	nes_buffer_free(&rewind->dirty);
+	nes_buffer_free(&rewind->data);
+	nes_buffer_free(&rewind->current);
+	memset(rewind, 0, sizeof(*rewind));
+	TRACE(LEVEL_VERBOSE, "%s", "Rewind unloaded");
+}
+
+void
+nes_rewind_write(
+	__inout nes_rewind_t *rewind,
+	__in size_t offset,
+	__in const void *data,
+	__in size_t length
+	)
+{
+	size_t first = rewind->data.length - offset;
+
+	if(first > length) {
+		first = length;
+	}
+
+	memcpy(rewind->data.ptr + offset, data, first);
+	memcpy(rewind->data.ptr, (const uint8_t *)data + first, length - first);
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,70 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NES_REWIND_TYPE_H_
+#define NES_REWIND_TYPE_H_
+
+#include "../../include/common.h"
+#include "../../include/common/rewind.h"
+
+#define REWIND_PAGE_HEADER (2 * sizeof(uint16_t))
+
+#define REWIND_RECORD_HEADER sizeof(uint32_t)
+
+#define REWIND_RUN_LITERAL 0x80
+#define REWIND_RUN_MAX 0x80
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void nes_rewind_decode(
+	__inout uint8_t *current,
+	__in const uint8_t *data,
+	__in size_t length
+	);
+
+size_t nes_rewind_encode(
+	__inout uint8_t *current,
+	__in const uint8_t *live,
+	__in size_t width,
+	__inout uint8_t *data
+	);
+
+void nes_rewind_read(
+	__in const nes_rewind_t *rewind,
+	__in size_t offset,
+	__inout void *data,
+	__in size_t length
+	);
+
+void nes_rewind_write(
+	__inout nes_rewind_t *rewind,
+	__in size_t offset,
+	__in const void *data,
+	__in size_t length
+	);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NES_REWIND_TYPE_H_ */
@@ -0,0 +1,152 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./headless_type.h"
+
+#ifdef HEADLESS
+
+static nes_headless_t g_headless = {};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+float
+nes_service_audio(
+	__in const int16_t *sample,
+	__in uint32_t count
+	)
+{
+
+	if(g_headless.callback.audio) {
+		nes_samples_t samples = { .buffer = sample, .count = count, .rate = g_headless.rate };
+
+		g_headless.callback.audio(&samples, g_headless.callback.context);
+	}
+
+	return 1.f;
+}
+
+double
+nes_service_elapsed(void)
+{
+	struct timespec current;
+
+	timespec_get(&current, TIME_UTC);
+
+	return (current.tv_sec - g_headless.frame_begin.tv_sec) + ((current.tv_nsec - g_headless.frame_begin.tv_nsec) / (double)NANOSEC_PER_SEC);
+}
+
+int
+nes_service_load(
+	__in const nes_t *configuration
+	)
+{
+	int result = NES_OK;
+
+	TRACE(LEVEL_VERBOSE, "%s", "Service loading");
+	memset(&g_headless, 0, sizeof(g_headless));
+
+	if((configuration->display.format < 0) || (configuration->display.format >= NES_FORMAT_MAX)) {
+		result = ERROR(NES_ERR, "invalid display format -- %i", configuration->display.format);
+		goto exit;
+	}
+
+	g_headless.format = configuration->display.format;
+	TRACE(LEVEL_VERBOSE, "Service format: %i (%zu bytes per pixel)", g_headless.format, FORMAT_WIDTH[g_headless.format]);
+
+	if((result = nes_palette_load(&g_headless.palette, &configuration->display.palette)) != NES_OK) {
+		goto exit;
+	}
+
+	g_headless.callback = configuration->callback;
+	g_headless.rate = configuration->sound.rate ? configuration->sound.rate : AUDIO_SAMPLE_RATE;
+	timespec_get(&g_headless.frame_begin, TIME_UTC);
+	TRACE(LEVEL_INFORMATION, "%s", "Headless service");
+	TRACE(LEVEL_VERBOSE, "%s", "Service loaded");
+
+exit:
+	return result;
+}
+
+void
+nes_service_pixel(
+	__in uint16_t color,
+	__in uint32_t x,
+	__in uint32_t y
+	)
+{
+
+	switch(g_headless.format) {
+		case NES_FORMAT_RGB565:
+			g_headless.pixel.rgb565[y][x] = g_headless.palette.rgb565[color % VIDEO_COLOR_MAX];
+			break;
+		case NES_FORMAT_INDEXED8:
+			g_headless.pixel.indexed[y][x] = g_headless.palette.indexed[color % VIDEO_COLOR_MAX];
+			break;
+		default:
+			g_headless.pixel.argb8888[y][x].raw = g_headless.palette.color[color % VIDEO_COLOR_MAX].raw;
+			break;
+	}
+}
+
+int
+nes_service_poll(
+	__inout uint8_t *state,
+	__inout unsigned *speed,
+	__inout bool *rewind
+	)
+{
+	return NES_OK;
+}
+
+int
+nes_service_show(
+	__in bool skip
+	)
+{
+
+	if(!skip && g_headless.callback.frame) {
+		nes_frame_t frame = { .buffer = &g_headless.pixel, .format = g_headless.format, .height = VIDEO_HEIGHT,
+			.number = g_headless.frame, .pitch = VIDEO_WIDTH * FORMAT_WIDTH[g_headless.format], .width = VIDEO_WIDTH };
+
+		g_headless.callback.frame(&frame, g_headless.callback.context);
+	}
+
+	++g_headless.frame;
+
+	return NES_OK;
+}
+
+void
+nes_service_unload(void)
+{
+	TRACE(LEVEL_VERBOSE, "%s", "Service unloading");
+	TRACE(LEVEL_INFORMATION, "Service frames: %lu (%.02f fps)", g_headless.frame, g_headless.frame / nes_service_elapsed());
+	memset(&g_headless, 0, sizeof(g_headless));
+	TRACE(LEVEL_VERBOSE, "%s", "Service unloaded");
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* HEADLESS */
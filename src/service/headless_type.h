@@ -0,0 +1,56 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NES_HEADLESS_TYPE_H_
+#define NES_HEADLESS_TYPE_H_
+
+#ifdef HEADLESS
+
+#include "../../include/service.h"
+
+typedef struct {
+	nes_callback_t callback;
+	int format;
+	uint64_t frame;
+	struct timespec frame_begin;
+	nes_palette_t palette;
+	unsigned rate;
+
+	union {
+		uint8_t indexed[VIDEO_HEIGHT][VIDEO_WIDTH];
+		uint16_t rgb565[VIDEO_HEIGHT][VIDEO_WIDTH];
+		nes_color_t argb8888[VIDEO_HEIGHT][VIDEO_WIDTH];
+	} pixel;
+} nes_headless_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+double nes_service_elapsed(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* HEADLESS */
+
+#endif /* NES_HEADLESS_TYPE_H_ */
@@ -29,6 +29,75 @@ static nes_sdl_t g_sdl = {};
 extern "C" {
 #endif /* __cplusplus */
 
+float
+nes_service_audio(
+	__in const int16_t *sample,
+	__in uint32_t count
+	)
+{
+	float result = 1.f;
+
+	if(g_sdl.callback.audio) {
+		nes_samples_t samples = { .buffer = sample, .count = count, .rate = g_sdl.rate };
+
+		g_sdl.callback.audio(&samples, g_sdl.callback.context);
+	}
+
+	if(g_sdl.audio && !g_sdl.speed) {
+		nes_sdl_ring_t *ring = &g_sdl.ring;
+		unsigned fill, write = atomic_load_explicit(&ring->write, memory_order_relaxed);
+
+		fill = write - atomic_load_explicit(&ring->read, memory_order_acquire);
+		result += (AUDIO_RING_SKEW * ((int)AUDIO_RING_TARGET - (int)fill)) / AUDIO_RING_TARGET;
+
+		if(result < (1.f - AUDIO_RING_SKEW)) {
+			result = 1.f - AUDIO_RING_SKEW;
+		}
+
+		if(count > (AUDIO_RING_MAX - fill)) {
+			TRACE(LEVEL_VERBOSE, "%s", "Service audio ring overrun");
+			count = AUDIO_RING_MAX - fill;
+		}
+
+		for(uint32_t index = 0; index < count; ++index) {
+			ring->sample[(write + index) % AUDIO_RING_MAX] = sample[index];
+		}
+
+		atomic_store_explicit(&ring->write, write + count, memory_order_release);
+	}
+
+	return result;
+}
+
+void
+nes_service_audio_callback(
+	__in void *context,
+	__inout Uint8 *stream,
+	__in int length
+	)
+{
+	nes_sdl_ring_t *ring = context;
+	int16_t *sample = (int16_t *)stream;
+	unsigned available, count = length / sizeof(*sample), read = atomic_load_explicit(&ring->read, memory_order_relaxed);
+
+	available = atomic_load_explicit(&ring->write, memory_order_acquire) - read;
+
+	if(available > count) {
+		available = count;
+	}
+
+	for(unsigned index = 0; index < count; ++index) {
+
+		if(index < available) {
+			ring->last = ring->sample[(read + index) % AUDIO_RING_MAX];
+		}
+
+		sample[index] = ring->last;
+	}
+
+	atomic_store_explicit(&ring->read, read + available, memory_order_release);
+}
+
 int
 nes_service_clear(void)
 {
@@ -36,7 +105,7 @@ nes_service_clear(void)
 	for(size_t y = 0; y < WINDOW_HEIGHT; ++y) {
 
 		for(size_t x = 0; x < WINDOW_WIDTH; ++x) {
-			g_sdl.pixel[y][x].raw = FOREGROUND.raw;
+			nes_service_color(x, y, &FOREGROUND);
 		}
 	}
 
@@ -44,21 +113,162 @@ nes_service_clear(void)
 #define PALETTE_OFFSET 8
 
 	for(size_t index = 0; index < PALETTE_MAX; ++index) {
-		const nes_color_t *color = &PALETTE[index];
 		size_t base_x = index % BLOCK_WIDTH, base_y = index / BLOCK_WIDTH;
 
 		for(size_t offset_y = 0; offset_y < PALETTE_OFFSET; ++offset_y) {
 
 			for(size_t offset_x = 0; offset_x < PALETTE_OFFSET; ++offset_x) {
-				g_sdl.pixel[(PALETTE_OFFSET * base_y) + offset_y][(PALETTE_OFFSET * base_x) + offset_x].raw
-					= (!offset_x || !offset_y || (offset_x == (PALETTE_OFFSET - 1)) || (offset_y == (PALETTE_OFFSET - 1)))
-						? FOREGROUND.raw : color->raw;
+				size_t x = (PALETTE_OFFSET * base_x) + offset_x, y = (PALETTE_OFFSET * base_y) + offset_y;
+
+				if(!offset_x || !offset_y || (offset_x == (PALETTE_OFFSET - 1)) || (offset_y == (PALETTE_OFFSET - 1))) {
+					nes_service_color(x, y, &FOREGROUND);
+				} else {
+					nes_service_pixel(index, x, y);
+				}
 			}
 		}
 	}
 #endif /* NDEBUG */
 
-	return nes_service_show();
+	return nes_service_show(false);
+}
+
+void
+nes_service_color(
+	__in uint32_t x,
+	__in uint32_t y,
+	__in const nes_color_t *color
+	)
+{
+	nes_sdl_frame_t *canvas = &g_sdl.present.buffer[g_sdl.present.back];
+
+	if(g_sdl.filter == NES_FILTER_NTSC) {
+		canvas->color[y][x] = PALETTE_BLACK;
+	}
+
+	switch(g_sdl.pixel_format) {
+		case NES_FORMAT_RGB565:
+			canvas->pixel.rgb565[y][x] = ((color->red >> 3) << 11) | ((color->green >> 2) << 5) | (color->blue >> 3);
+			break;
+		case NES_FORMAT_INDEXED8:
+			canvas->pixel.indexed[y][x] = PALETTE_BLACK;
+			break;
+		default:
+			canvas->pixel.argb8888[y][x].raw = color->raw;
+			break;
+	}
+}
+
+void
+nes_service_controller(
+	__in int index,
+	__in bool attached
+	)
+{
+
+	for(uint8_t controller = 0; controller < NES_CONTROLLER_MAX; ++controller) {
+
+		if(attached && !g_sdl.controller[controller]) {
+
+			if(!(g_sdl.controller[controller] = SDL_GameControllerOpen(index))) {
+				TRACE(LEVEL_WARNING, "Service controller unavailable -- %s", SDL_GetError());
+			} else {
+				TRACE(LEVEL_VERBOSE, "Service controller %u attached", controller + 1);
+			}
+			break;
+		} else if(!attached && g_sdl.controller[controller] && !SDL_GameControllerGetAttached(g_sdl.controller[controller])) {
+			SDL_GameControllerClose(g_sdl.controller[controller]);
+			g_sdl.controller[controller] = NULL;
+			TRACE(LEVEL_VERBOSE, "Service controller %u detached", controller + 1);
+		}
+	}
+}
+
+void
+nes_service_expand(
+	__inout nes_sdl_frame_t *frame
+	)
+{
+	nes_color_t *color = (nes_color_t *)&frame->pixel;
+	const uint8_t *indexed = (const uint8_t *)&frame->pixel;
+
+	/* Widen in place, back to front, so each index is read before its color overwrites it */
+	for(size_t index = WINDOW_WIDTH * WINDOW_HEIGHT; index-- > 0;) {
+		color[index].raw = g_sdl.palette.color[indexed[index]].raw;
+	}
+}
+
+int
+nes_service_frame(
+	__inout nes_sdl_frame_t *source,
+	__inout uint8_t *texture,
+	__in size_t pitch
+	)
+{
+	int result = NES_OK;
+	uint32_t scale = nes_filter_scale(g_sdl.filter);
+	size_t width = WINDOW_WIDTH * scale * sizeof(nes_color_t);
+	void *output = (pitch == width) ? (void *)texture : (void *)g_sdl.filtered;
+
+	if(g_sdl.filter == NES_FILTER_NONE) {
+		width = WINDOW_WIDTH * FORMAT_WIDTH[g_sdl.pixel_format];
+
+		for(size_t y = 0; y < WINDOW_HEIGHT; ++y, texture += pitch) {
+
+			if(g_sdl.pixel_format == NES_FORMAT_INDEXED8) {
+
+				for(size_t x = 0; x < WINDOW_WIDTH; ++x) {
+					((nes_color_t *)texture)[x].raw = g_sdl.palette.color[source->pixel.indexed[y][x]].raw;
+				}
+			} else {
+				memcpy(texture, (const uint8_t *)&source->pixel + (y * width), width);
+			}
+		}
+
+		goto exit;
+	}
+
+	if(g_sdl.filter == NES_FILTER_NTSC) {
+
+		if((result = nes_filter(g_sdl.filter, NES_FORMAT_ARGB8888, source->color, output, WINDOW_WIDTH, WINDOW_HEIGHT)) != NES_OK) {
+			goto exit;
+		}
+	} else if((g_sdl.pixel_format == NES_FORMAT_INDEXED8) && (g_sdl.filter != NES_FILTER_HQ2X)) {
+
+		if((result = nes_filter(g_sdl.filter, NES_FORMAT_INDEXED8, source->pixel.indexed, g_sdl.filtered_indexed, WINDOW_WIDTH, WINDOW_HEIGHT))
+				!= NES_OK) {
+			goto exit;
+		}
+
+		for(size_t y = 0; y < (WINDOW_HEIGHT * scale); ++y, texture += pitch) {
+			const uint8_t *row = &g_sdl.filtered_indexed[y * WINDOW_WIDTH * scale];
+
+			for(size_t x = 0; x < (WINDOW_WIDTH * scale); ++x) {
+				((nes_color_t *)texture)[x].raw = g_sdl.palette.color[row[x]].raw;
+			}
+		}
+
+		goto exit;
+	} else {
+
+		if(g_sdl.pixel_format == NES_FORMAT_INDEXED8) {
+			nes_service_expand(source);
+		}
+
+		if((result = nes_filter(g_sdl.filter, NES_FORMAT_ARGB8888, source->pixel.argb8888, output, WINDOW_WIDTH, WINDOW_HEIGHT)) != NES_OK) {
+			goto exit;
+		}
+	}
+
+	if(output != texture) {
+
+		for(size_t y = 0; y < (WINDOW_HEIGHT * scale); ++y, texture += pitch) {
+			memcpy(texture, (const uint8_t *)output + (y * width), width);
+		}
+	}
+
+exit:
+	return result;
 }
 
 int
@@ -69,11 +279,16 @@ nes_service_fullscreen(void)
 
 	if(g_sdl.window) {
 
+		mtx_lock(&g_sdl.present.window);
+
 		if(SDL_SetWindowFullscreen(g_sdl.window, fullscreen ? SDL_WINDOW_FULLSCREEN_DESKTOP : 0)) {
+			mtx_unlock(&g_sdl.present.window);
 			result = ERROR(NES_ERR, "sdl error -- %s", SDL_GetError());
 			goto exit;
 		}
 
+		mtx_unlock(&g_sdl.present.window);
+
 		SDL_ShowCursor(fullscreen ? SDL_DISABLE : SDL_ENABLE);
 	}
 
@@ -84,14 +299,6 @@ exit:
 	return result;
 }
 
-bool
-nes_service_key(
-	__in int key
-	)
-{
-	return (SDL_GetKeyboardState(NULL)[key] > 0);
-}
-
 int
 nes_service_load(
 	__in const nes_t *configuration
@@ -117,28 +324,40 @@ nes_service_load(
 
 	TRACE(LEVEL_VERBOSE, "Service scale: %u", g_sdl.scale);
 
-	if(SDL_Init(SDL_INIT_VIDEO)) {
-		result = ERROR(NES_ERR, "sdl error -- %s", SDL_GetError());
+	if((configuration->display.format < 0) || (configuration->display.format >= NES_FORMAT_MAX)) {
+		result = ERROR(NES_ERR, "invalid display format -- %i", configuration->display.format);
 		goto exit;
 	}
 
-	if(!(g_sdl.window = SDL_CreateWindow(g_sdl.title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, WINDOW_WIDTH * g_sdl.scale, WINDOW_HEIGHT * g_sdl.scale,
-			SDL_WINDOW_RESIZABLE))) {
-		result = ERROR(NES_ERR, "sdl error -- %s", SDL_GetError());
+	g_sdl.pixel_format = configuration->display.format;
+	TRACE(LEVEL_VERBOSE, "Service format: %i (%zu bytes per pixel)", g_sdl.pixel_format, FORMAT_WIDTH[g_sdl.pixel_format]);
+
+	if((configuration->display.filter < 0) || (configuration->display.filter >= NES_FILTER_MAX)) {
+		result = ERROR(NES_ERR, "invalid display filter -- %i", configuration->display.filter);
+		goto exit;
+	} else if((configuration->display.filter != NES_FILTER_NONE) && (configuration->display.filter != NES_FILTER_NTSC)
+			&& (g_sdl.pixel_format == NES_FORMAT_RGB565)) {
+		result = ERROR(NES_ERR, "unsupported display filter format -- %i", g_sdl.pixel_format);
 		goto exit;
 	}
 
-	if(!(g_sdl.renderer = SDL_CreateRenderer(g_sdl.window, -1, SDL_RENDERER_ACCELERATED))) {
-		result = ERROR(NES_ERR, "sdl error -- %s", SDL_GetError());
+	g_sdl.filter = configuration->display.filter;
+	TRACE(LEVEL_VERBOSE, "Service filter: %i (%ux)", g_sdl.filter, nes_filter_scale(g_sdl.filter));
+
+	g_sdl.skip = configuration->display.skip ? configuration->display.skip : FRAME_SKIP;
+	TRACE(LEVEL_VERBOSE, "Service skip: %u", g_sdl.skip);
+
+	if((result = nes_palette_load(&g_sdl.palette, &configuration->display.palette)) != NES_OK) {
 		goto exit;
 	}
 
-	if(SDL_RenderSetLogicalSize(g_sdl.renderer, WINDOW_WIDTH, WINDOW_HEIGHT)) {
+	if(SDL_Init(SDL_INIT_VIDEO)) {
 		result = ERROR(NES_ERR, "sdl error -- %s", SDL_GetError());
 		goto exit;
 	}
 
-	if(SDL_SetRenderDrawColor(g_sdl.renderer, BACKGROUND.red, BACKGROUND.green, BACKGROUND.blue, BACKGROUND.alpha)) {
+	if(!(g_sdl.window = SDL_CreateWindow(g_sdl.title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, WINDOW_WIDTH * g_sdl.scale, WINDOW_HEIGHT * g_sdl.scale,
+			SDL_WINDOW_RESIZABLE))) {
 		result = ERROR(NES_ERR, "sdl error -- %s", SDL_GetError());
 		goto exit;
 	}
@@ -148,40 +367,134 @@ nes_service_load(
 		goto exit;
 	}
 
-	if(!(g_sdl.texture = SDL_CreateTexture(g_sdl.renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, WINDOW_WIDTH, WINDOW_HEIGHT))) {
-		result = ERROR(NES_ERR, "sdl error -- %s", SDL_GetError());
+	if((result = nes_service_present_load()) != NES_OK) {
 		goto exit;
 	}
 
+	g_sdl.rate = configuration->sound.rate ? configuration->sound.rate : AUDIO_SAMPLE_RATE;
+
+	if(SDL_InitSubSystem(SDL_INIT_AUDIO)) {
+		TRACE(LEVEL_WARNING, "Service audio unavailable -- %s", SDL_GetError());
+	} else {
+		SDL_AudioSpec spec = {};
+		spec.callback = nes_service_audio_callback;
+		spec.channels = AUDIO_CHANNELS;
+		spec.format = AUDIO_S16SYS;
+		spec.freq = g_sdl.rate;
+		spec.samples = AUDIO_SAMPLES;
+		spec.userdata = &g_sdl.ring;
+
+		if(!(g_sdl.audio = SDL_OpenAudioDevice(NULL, 0, &spec, NULL, 0))) {
+			TRACE(LEVEL_WARNING, "Service audio unavailable -- %s", SDL_GetError());
+		} else {
+			SDL_PauseAudioDevice(g_sdl.audio, 0);
+			TRACE(LEVEL_VERBOSE, "Service audio: %i Hz", g_sdl.rate);
+		}
+	}
+
+	if(SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER)) {
+		TRACE(LEVEL_WARNING, "Service controller unavailable -- %s", SDL_GetError());
+	}
+
 	if((result = nes_service_clear()) != NES_OK) {
 		goto exit;
 	}
 
+	g_sdl.callback = configuration->callback;
+	g_sdl.frame_number = 0;
+
 	if(configuration->display.fullscreen) {
 		nes_service_fullscreen();
 	}
 
+	g_sdl.framerate_begin = nes_service_timestamp();
 	TRACE(LEVEL_VERBOSE, "%s", "Service loaded");
 
 exit:
 	return result;
 }
 
+void
+nes_service_pace(void)
+{
+	uint64_t current = nes_service_timestamp();
+
+	if(g_sdl.speed) {
+		g_sdl.pace.begin = 0;
+	} else if(g_sdl.audio) {
+		unsigned fill = atomic_load_explicit(&g_sdl.ring.write, memory_order_relaxed) - atomic_load_explicit(&g_sdl.ring.read, memory_order_acquire);
+
+		if(fill > AUDIO_RING_TARGET) {
+			SDL_Delay(((fill - AUDIO_RING_TARGET) * MILLISEC_PER_SEC) / g_sdl.rate);
+			current = nes_service_timestamp();
+		}
+	} else {
+		uint64_t deadline;
+
+		if(!g_sdl.pace.begin || (current > (g_sdl.pace.begin + FRAME_DEADLINE(g_sdl.pace.count + 1) + FRAME_RESYNC))) {
+			TRACE(LEVEL_VERBOSE, "Service pace resync: %lu frames", g_sdl.pace.count);
+			g_sdl.pace.begin = current;
+			g_sdl.pace.count = 0;
+		}
+
+		deadline = g_sdl.pace.begin + FRAME_DEADLINE(++g_sdl.pace.count);
+
+		if(deadline > (current + FRAME_SPIN)) {
+			struct timespec wake = { .tv_sec = (deadline - FRAME_SPIN) / NANOSEC_PER_SEC, .tv_nsec = (deadline - FRAME_SPIN) % NANOSEC_PER_SEC };
+
+			while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, NULL) == EINTR);
+		}
+
+		while((current = nes_service_timestamp()) < deadline);
+	}
+
+	if(g_sdl.pace.previous) {
+		g_sdl.pace.sample[g_sdl.pace.sample_count++ % FRAME_TIMING_MAX] = (current - g_sdl.pace.previous) / NANOSEC_PER_MICROSEC;
+	}
+
+	g_sdl.pace.previous = current;
+}
+
 void
 nes_service_pixel(
-	__in uint8_t color,
+	__in uint16_t color,
 	__in uint32_t x,
 	__in uint32_t y
 	)
 {
-	g_sdl.pixel[y][x].raw = PALETTE[color % PALETTE_MAX].raw;
+	nes_sdl_frame_t *canvas = &g_sdl.present.buffer[g_sdl.present.back];
+
+	if(g_sdl.filter == NES_FILTER_NTSC) {
+		canvas->color[y][x] = color;
+
+		if(!g_sdl.callback.frame) {
+			return;
+		}
+	}
+
+	switch(g_sdl.pixel_format) {
+		case NES_FORMAT_RGB565:
+			canvas->pixel.rgb565[y][x] = g_sdl.palette.rgb565[color % VIDEO_COLOR_MAX];
+			break;
+		case NES_FORMAT_INDEXED8:
+			canvas->pixel.indexed[y][x] = g_sdl.palette.indexed[color % VIDEO_COLOR_MAX];
+			break;
+		default:
+			canvas->pixel.argb8888[y][x].raw = g_sdl.palette.color[color % VIDEO_COLOR_MAX].raw;
+			break;
+	}
 }
 
 int
-nes_service_poll(void)
+nes_service_poll(
+	__inout uint8_t *state,
+	__inout unsigned *speed,
+	__inout bool *rewind
+	)
 {
 	int result = NES_OK;
 	SDL_Event event = {};
+	const Uint8 *keyboard;
 
 	while(SDL_PollEvent(&event)) {
 
@@ -197,11 +510,21 @@ nes_service_poll(void)
 								goto exit;
 							}
 							break;
+						case KEY_SPEED:
+							*speed = *speed ? 0 : g_sdl.skip;
+							TRACE(LEVEL_INFORMATION, "Service speed: %u", *speed);
+							break;
 						default:
 							break;
 					}
 				}
 				break;
+			case SDL_CONTROLLERDEVICEADDED:
+				nes_service_controller(event.cdevice.which, true);
+				break;
+			case SDL_CONTROLLERDEVICEREMOVED:
+				nes_service_controller(event.cdevice.which, false);
+				break;
 			case SDL_QUIT:
 				TRACE(LEVEL_WARNING, "%s", "Service quit event");
 				result = NES_EVT;
@@ -211,68 +534,319 @@ nes_service_poll(void)
 		}
 	}
 
+	keyboard = SDL_GetKeyboardState(NULL);
+	memset(state, 0, NES_CONTROLLER_MAX * sizeof(*state));
+	*rewind = keyboard[KEY_REWIND];
+
+	for(uint8_t button = 0; button < NES_BUTTON_MAX; ++button) {
+
+		if(keyboard[KEY_BUTTON[button]]) {
+			state[NES_CONTROLLER_1] |= (1 << button);
+		}
+
+		for(uint8_t controller = 0; controller < NES_CONTROLLER_MAX; ++controller) {
+
+			if(g_sdl.controller[controller] && SDL_GameControllerGetButton(g_sdl.controller[controller], CONTROLLER_BUTTON[button])) {
+				state[controller] |= (1 << button);
+			}
+		}
+	}
+
+	g_sdl.speed = *speed;
+
 exit:
 	return result;
 }
 
 int
-nes_service_show(void)
+nes_service_present(
+	__inout nes_sdl_frame_t *source
+	)
 {
-	uint32_t elapsed;
-	int result = NES_OK;
+	int pitch, result = NES_OK;
+	void *texture = NULL;
+	nes_sdl_present_t *present = &g_sdl.present;
+
+	if(SDL_LockTexture(present->texture, NULL, &texture, &pitch)) {
+		TRACE(LEVEL_WARNING, "Service present failed -- %s", SDL_GetError());
+		result = NES_ERR;
+		goto exit;
+	}
+
+	result = nes_service_frame(source, texture, pitch);
+	SDL_UnlockTexture(present->texture);
 
-	if(SDL_RenderClear(g_sdl.renderer)) {
-		result = ERROR(NES_OK, "sdl error -- %s", SDL_GetError());
+	if(result != NES_OK) {
 		goto exit;
 	}
 
-	if(SDL_UpdateTexture(g_sdl.texture, NULL, g_sdl.pixel, WINDOW_WIDTH * sizeof(nes_color_t))) {
-		result = ERROR(NES_OK, "sdl error -- %s", SDL_GetError());
+	if(SDL_RenderClear(present->renderer)
+			|| SDL_RenderCopy(present->renderer, present->texture, NULL, NULL)) {
+		TRACE(LEVEL_WARNING, "Service present failed -- %s", SDL_GetError());
+		result = NES_ERR;
+		goto exit;
+	}
+
+	SDL_RenderPresent(present->renderer);
+
+exit:
+	return result;
+}
+
+int
+nes_service_present_load(void)
+{
+	int result = NES_OK;
+	nes_sdl_present_t *present = &g_sdl.present;
+
+	if((mtx_init(&present->lock, mtx_plain) != thrd_success)
+			|| (mtx_init(&present->window, mtx_plain) != thrd_success)
+			|| (cnd_init(&present->update) != thrd_success)) {
+		result = ERROR(NES_ERR, "%s", "failed to initialize service present synchronization");
 		goto exit;
 	}
 
-	if(SDL_RenderCopy(g_sdl.renderer, g_sdl.texture, NULL, NULL)) {
-		result = ERROR(NES_OK, "sdl error -- %s", SDL_GetError());
+	present->back = 0;
+	atomic_store(&present->middle, 1);
+	present->front = 2;
+	present->running = true;
+
+	if(thrd_create(&present->thread, nes_service_present_run, present) != thrd_success) {
+		result = ERROR(NES_ERR, "%s", "failed to create service present thread");
+		cnd_destroy(&present->update);
+		mtx_destroy(&present->window);
+		mtx_destroy(&present->lock);
 		goto exit;
 	}
 
-	SDL_RenderPresent(g_sdl.renderer);
+	present->started = true;
+	mtx_lock(&present->lock);
+
+	while(!present->ready) {
+		cnd_wait(&present->update, &present->lock);
+	}
+
+	result = present->result;
+	mtx_unlock(&present->lock);
+
+	if(result == NES_OK) {
+		TRACE(LEVEL_VERBOSE, "%s", "Service present loaded");
+	}
+
+exit:
+	return result;
+}
+
+void
+nes_service_present_publish(void)
+{
+	unsigned back;
+	nes_sdl_present_t *present = &g_sdl.present;
+
+	/* Pixels are drawn straight into the back slot, so publishing only swaps it with the middle slot */
+	back = atomic_exchange_explicit(&present->middle, present->back | PRESENT_FRESH, memory_order_acq_rel);
+
+	if(back & PRESENT_FRESH) {
+		++present->dropped;
+	}
+
+	present->back = back & PRESENT_INDEX;
+	mtx_lock(&present->lock);
+	cnd_signal(&present->update);
+	mtx_unlock(&present->lock);
+}
+
+int
+nes_service_present_run(
+	__in void *context
+	)
+{
+	int result = NES_OK;
+	nes_sdl_present_t *present = context;
+
+	if(!(present->renderer = SDL_CreateRenderer(g_sdl.window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC))) {
+		result = ERROR(NES_ERR, "sdl error -- %s", SDL_GetError());
+	} else if(SDL_RenderSetLogicalSize(present->renderer, WINDOW_WIDTH, WINDOW_HEIGHT)
+			|| SDL_SetRenderDrawColor(present->renderer, BACKGROUND.red, BACKGROUND.green, BACKGROUND.blue, BACKGROUND.alpha)) {
+		result = ERROR(NES_ERR, "sdl error -- %s", SDL_GetError());
+	} else if(!(present->texture = SDL_CreateTexture(present->renderer,
+			(g_sdl.filter != NES_FILTER_NONE) ? SDL_PIXELFORMAT_ARGB8888 : FORMAT_TEXTURE[g_sdl.pixel_format], SDL_TEXTUREACCESS_STREAMING,
+			WINDOW_WIDTH * nes_filter_scale(g_sdl.filter), WINDOW_HEIGHT * nes_filter_scale(g_sdl.filter)))) {
+		result = ERROR(NES_ERR, "sdl error -- %s", SDL_GetError());
+	}
+
+	mtx_lock(&present->lock);
+	present->ready = true;
+	present->result = result;
+	cnd_signal(&present->update);
+	mtx_unlock(&present->lock);
+
+	for(; result == NES_OK;) {
+		mtx_lock(&present->lock);
+
+		while(present->running && !(atomic_load_explicit(&present->middle, memory_order_relaxed) & PRESENT_FRESH)) {
+			cnd_wait(&present->update, &present->lock);
+		}
+
+		if(!present->running) {
+			mtx_unlock(&present->lock);
+			break;
+		}
+
+		mtx_unlock(&present->lock);
+		present->front = atomic_exchange_explicit(&present->middle, present->front, memory_order_acq_rel) & PRESENT_INDEX;
+
+		/* The window and event pump stay on the loading thread, so only presentation is serialized against its window changes */
+		mtx_lock(&present->window);
+
+		if(nes_service_present(&present->buffer[present->front]) == NES_OK) {
+			++present->presented;
+		}
+
+		mtx_unlock(&present->window);
+	}
+
+	if(present->texture) {
+		SDL_DestroyTexture(present->texture);
+		present->texture = NULL;
+	}
+
+	if(present->renderer) {
+		SDL_DestroyRenderer(present->renderer);
+		present->renderer = NULL;
+	}
+
+	return result;
+}
+
+void
+nes_service_present_unload(void)
+{
+	nes_sdl_present_t *present = &g_sdl.present;
+
+	if(!present->started) {
+		return;
+	}
+
+	mtx_lock(&present->lock);
+	present->running = false;
+	cnd_signal(&present->update);
+	mtx_unlock(&present->lock);
+	thrd_join(present->thread, NULL);
+	cnd_destroy(&present->update);
+	mtx_destroy(&present->window);
+	mtx_destroy(&present->lock);
+	present->started = false;
+	TRACE(LEVEL_VERBOSE, "Service present unloaded: %lu presented, %lu dropped", present->presented, present->dropped);
+}
+
+int
+nes_service_show(
+	__in bool skip
+	)
+{
+	int result = NES_OK;
+
+	if(!skip) {
 
-	if((elapsed = (SDL_GetTicks() - g_sdl.frame_begin)) < FRAME_FREQUENCY) {
-		SDL_Delay(FRAME_FREQUENCY - elapsed);
+		if(g_sdl.callback.frame) {
+			nes_frame_t frame = { .buffer = &g_sdl.present.buffer[g_sdl.present.back].pixel, .format = g_sdl.pixel_format,
+				.height = WINDOW_HEIGHT, .number = g_sdl.frame_number, .pitch = WINDOW_WIDTH * FORMAT_WIDTH[g_sdl.pixel_format],
+				.width = WINDOW_WIDTH };
+
+			g_sdl.callback.frame(&frame, g_sdl.callback.context);
+		}
+
+		nes_service_present_publish();
 	}
 
-	g_sdl.frame_begin = SDL_GetTicks();
+	++g_sdl.frame_number;
+
+	nes_service_pace();
 
 	if(g_sdl.frame >= FRAMES_PER_SEC) {
-		g_sdl.framerate = (g_sdl.frame / ((SDL_GetTicks() - g_sdl.framerate_begin) / (float)MILLISEC_PER_SEC));
-		g_sdl.framerate_begin = SDL_GetTicks();
+		uint64_t current = nes_service_timestamp();
+
+		g_sdl.framerate = g_sdl.frame / ((current - g_sdl.framerate_begin) / (float)NANOSEC_PER_SEC);
+		g_sdl.framerate_begin = current;
 		g_sdl.frame = 0;
-		TRACE(LEVEL_INFORMATION, "Service framerate: %.2f", g_sdl.framerate);
+		nes_service_timing();
+		TRACE(LEVEL_INFORMATION, "Service framerate: %.2f, x%.2f (min %.2f ms, avg %.2f ms, p99 %.2f ms, %lu dropped)", g_sdl.framerate,
+			g_sdl.framerate / FRAME_RATE, g_sdl.pace.minimum, g_sdl.pace.average, g_sdl.pace.percentile, g_sdl.present.dropped);
 #ifndef NDEBUG
-		snprintf(g_sdl.format, sizeof(g_sdl.format), "%s [%.02f]", g_sdl.title, g_sdl.framerate);
+		snprintf(g_sdl.format, sizeof(g_sdl.format), "%s [%.02f, x%.02f, p99 %.02f ms]", g_sdl.title, g_sdl.framerate,
+			g_sdl.framerate / FRAME_RATE, g_sdl.pace.percentile);
+		mtx_lock(&g_sdl.present.window);
 		SDL_SetWindowTitle(g_sdl.window, g_sdl.format);
+		mtx_unlock(&g_sdl.present.window);
 #endif /* NDEBUG */
 	} else {
 		++g_sdl.frame;
 	}
 
-exit:
 	return result;
 }
 
+uint64_t
+nes_service_timestamp(void)
+{
+	struct timespec current;
+
+	clock_gettime(CLOCK_MONOTONIC, &current);
+
+	return ((uint64_t)current.tv_sec * NANOSEC_PER_SEC) + current.tv_nsec;
+}
+
+void
+nes_service_timing(void)
+{
+	uint64_t total = 0;
+	uint32_t count, sample[FRAME_TIMING_MAX];
+
+	if(!(count = (g_sdl.pace.sample_count < FRAME_TIMING_MAX) ? g_sdl.pace.sample_count : FRAME_TIMING_MAX)) {
+		return;
+	}
+
+	memcpy(sample, g_sdl.pace.sample, count * sizeof(*sample));
+	qsort(sample, count, sizeof(*sample), nes_service_timing_compare);
+
+	for(uint32_t index = 0; index < count; ++index) {
+		total += sample[index];
+	}
+
+	g_sdl.pace.minimum = sample[0] / (float)MICROSEC_PER_MILLISEC;
+	g_sdl.pace.average = (total / (float)count) / MICROSEC_PER_MILLISEC;
+	g_sdl.pace.percentile = sample[((count - 1) * FRAME_TIMING_PERCENTILE) / 100] / (float)MICROSEC_PER_MILLISEC;
+}
+
+int
+nes_service_timing_compare(
+	__in const void *first,
+	__in const void *second
+	)
+{
+	uint32_t left = *(const uint32_t *)first, right = *(const uint32_t *)second;
+
+	return (left > right) - (left < right);
+}
+
 void nes_service_unload(void)
 {
 	TRACE(LEVEL_VERBOSE, "%s", "Service unloading");
 
-	if(g_sdl.texture) {
-		SDL_DestroyTexture(g_sdl.texture);
+	if(g_sdl.audio) {
+		SDL_CloseAudioDevice(g_sdl.audio);
 	}
 
-	if(g_sdl.renderer) {
-		SDL_DestroyRenderer(g_sdl.renderer);
+	for(uint8_t controller = 0; controller < NES_CONTROLLER_MAX; ++controller) {
+
+		if(g_sdl.controller[controller]) {
+			SDL_GameControllerClose(g_sdl.controller[controller]);
+		}
 	}
 
+	nes_service_present_unload();
+
 	if(g_sdl.window) {
 		SDL_DestroyWindow(g_sdl.window);
 	}
@@ -24,11 +24,45 @@
 
 #ifdef SDL
 
+#define _POSIX_C_SOURCE 200809L
+
 #include <SDL2/SDL.h>
+#include <errno.h>
 #include <libgen.h>
+#include <stdatomic.h>
+#include <threads.h>
 #include "../../include/service.h"
 
+#define AUDIO_CHANNELS 1
+#define AUDIO_RING_MAX 0x2000
+#define AUDIO_RING_SKEW 0.005f
+#define AUDIO_RING_TARGET (AUDIO_SAMPLES * 2)
+#define AUDIO_SAMPLES 1024
+
+#define FILTER_SCALE_MAX 3
+
+#define FRAME_PERIOD_DENOMINATOR 945
+#define FRAME_PERIOD_NUMERATOR 15724104000
+#define FRAME_RATE ((NANOSEC_PER_SEC * (float)FRAME_PERIOD_DENOMINATOR) / FRAME_PERIOD_NUMERATOR)
+#define FRAME_RESYNC (50 * NANOSEC_PER_MILLISEC)
+#define FRAME_SKIP 4
+#define FRAME_SPIN 500000
+#define FRAME_TIMING_MAX 256
+#define FRAME_TIMING_PERCENTILE 99
+
+#define FRAME_DEADLINE(_COUNT_) \
+	(((_COUNT_) * FRAME_PERIOD_NUMERATOR) / FRAME_PERIOD_DENOMINATOR)
+
 #define KEY_FULLSCREEN SDL_SCANCODE_F11
+#define KEY_REWIND SDL_SCANCODE_BACKSPACE
+#define KEY_SPEED SDL_SCANCODE_TAB
+
+#define PALETTE_BLACK 0x0f
+#define PALETTE_MAX VIDEO_COLOR_PALETTE
+
+#define PRESENT_FRESH 0x04
+#define PRESENT_INDEX 0x03
+#define PRESENT_MAX 3
 
 #define SCALE_MAX 4
 #define SCALE_MIN 1
@@ -38,28 +72,74 @@
 #define WINDOW_HEIGHT 240
 #define WINDOW_WIDTH 256
 
-typedef union {
+typedef struct {
+	uint16_t color[WINDOW_HEIGHT][WINDOW_WIDTH];
 
-        struct {
-                uint8_t blue;
-                uint8_t green;
-                uint8_t red;
-                uint8_t alpha;
-        };
+	union {
+		uint8_t indexed[WINDOW_HEIGHT][WINDOW_WIDTH];
+		uint16_t rgb565[WINDOW_HEIGHT][WINDOW_WIDTH];
+		nes_color_t argb8888[WINDOW_HEIGHT][WINDOW_WIDTH];
+	} pixel;
+} nes_sdl_frame_t;
 
-        uint32_t raw;
-} nes_color_t;
+typedef struct {
+	float average;
+	uint64_t begin;
+	uint64_t count;
+	float minimum;
+	float percentile;
+	uint64_t previous;
+	uint32_t sample[FRAME_TIMING_MAX];
+	uint32_t sample_count;
+} nes_sdl_pace_t;
 
 typedef struct {
+	unsigned back;
+	nes_sdl_frame_t buffer[PRESENT_MAX];
+	uint64_t dropped;
+	unsigned front;
+	mtx_t lock;
+	atomic_uint middle;
+	uint64_t presented;
+	bool ready;
+	SDL_Renderer *renderer;
+	int result;
+	bool running;
+	bool started;
+	SDL_Texture *texture;
+	thrd_t thread;
+	cnd_t update;
+	mtx_t window;
+} nes_sdl_present_t;
+
+typedef struct {
+	atomic_uint read;
+	int16_t last;
+	int16_t sample[AUDIO_RING_MAX];
+	atomic_uint write;
+} nes_sdl_ring_t;
+
+typedef struct {
+	SDL_AudioDeviceID audio;
+	nes_callback_t callback;
+	SDL_GameController *controller[NES_CONTROLLER_MAX];
 	uint32_t frame;
-	uint32_t frame_begin;
+	uint64_t frame_number;
 	float framerate;
-	uint32_t framerate_begin;
+	uint64_t framerate_begin;
+	int filter;
+	nes_color_t filtered[WINDOW_HEIGHT * WINDOW_WIDTH * FILTER_SCALE_MAX * FILTER_SCALE_MAX];
+	uint8_t filtered_indexed[WINDOW_HEIGHT * WINDOW_WIDTH * FILTER_SCALE_MAX * FILTER_SCALE_MAX];
 	bool fullscreen;
-	nes_color_t pixel[WINDOW_HEIGHT][WINDOW_WIDTH];
-	SDL_Renderer *renderer;
+	nes_palette_t palette;
+	nes_sdl_pace_t pace;
+	int pixel_format;
+	nes_sdl_present_t present;
+	int rate;
+	nes_sdl_ring_t ring;
         uint8_t scale;
-	SDL_Texture *texture;
+	unsigned skip;
+	unsigned speed;
 	char title[TITLE_MAX];
 	SDL_version version;
 	SDL_Window *window;
@@ -68,94 +148,97 @@ typedef struct {
 #endif /* NDEBUG */
 } nes_sdl_t;
 
+static const SDL_GameControllerButton CONTROLLER_BUTTON[] = {
+	SDL_CONTROLLER_BUTTON_B, /* NES_BUTTON_A */
+	SDL_CONTROLLER_BUTTON_A, /* NES_BUTTON_B */
+	SDL_CONTROLLER_BUTTON_BACK, /* NES_BUTTON_SELECT */
+	SDL_CONTROLLER_BUTTON_START, /* NES_BUTTON_START */
+	SDL_CONTROLLER_BUTTON_DPAD_UP, /* NES_BUTTON_UP */
+	SDL_CONTROLLER_BUTTON_DPAD_DOWN, /* NES_BUTTON_DOWN */
+	SDL_CONTROLLER_BUTTON_DPAD_LEFT, /* NES_BUTTON_LEFT */
+	SDL_CONTROLLER_BUTTON_DPAD_RIGHT, /* NES_BUTTON_RIGHT */
+	};
+
+static const uint32_t FORMAT_TEXTURE[] = {
+	SDL_PIXELFORMAT_ARGB8888, /* NES_FORMAT_ARGB8888 */
+	SDL_PIXELFORMAT_RGB565, /* NES_FORMAT_RGB565 */
+	SDL_PIXELFORMAT_ARGB8888, /* NES_FORMAT_INDEXED8 */
+	};
+
+static const SDL_Scancode KEY_BUTTON[] = {
+	SDL_SCANCODE_X, /* NES_BUTTON_A */
+	SDL_SCANCODE_Z, /* NES_BUTTON_B */
+	SDL_SCANCODE_RSHIFT, /* NES_BUTTON_SELECT */
+	SDL_SCANCODE_RETURN, /* NES_BUTTON_START */
+	SDL_SCANCODE_UP, /* NES_BUTTON_UP */
+	SDL_SCANCODE_DOWN, /* NES_BUTTON_DOWN */
+	SDL_SCANCODE_LEFT, /* NES_BUTTON_LEFT */
+	SDL_SCANCODE_RIGHT, /* NES_BUTTON_RIGHT */
+	};
+
 static const nes_color_t BACKGROUND = {{ 0x00, 0x00, 0x00, 0xff }};
 static const nes_color_t FOREGROUND = {{ 0x10, 0x10, 0x10, 0xff }};
 
-static const nes_color_t PALETTE[] = {
-        /* 0x00 */
-        {{ 0x7c, 0x7c, 0x7c, 0xff }},
-        {{ 0xfc, 0x00, 0x00, 0xff }},
-        {{ 0xbc, 0x00, 0x00, 0xff }},
-        {{ 0xbc, 0x28, 0x44, 0xff }},
-        {{ 0x84, 0x00, 0x94, 0xff }},
-        {{ 0x20, 0x00, 0xa8, 0xff }},
-        {{ 0x00, 0x10, 0xa8, 0xff }},
-        {{ 0x00, 0x14, 0x88, 0xff }},
-        /* 0x08 */
-        {{ 0x00, 0x30, 0x50, 0xff }},
-        {{ 0x00, 0x78, 0x00, 0xff }},
-        {{ 0x00, 0x68, 0x00, 0xff }},
-        {{ 0x00, 0x58, 0x00, 0xff }},
-        {{ 0x58, 0x40, 0x00, 0xff }},
-        {{ 0x00, 0x00, 0x00, 0xff }},
-        {{ 0x00, 0x00, 0x00, 0xff }},
-        {{ 0x00, 0x00, 0x00, 0xff }},
-        /* 0x10 */
-        {{ 0xbc, 0xbc, 0xbc, 0xff }},
-        {{ 0xf8, 0x78, 0x00, 0xff }},
-        {{ 0xf8, 0x58, 0x00, 0xff }},
-        {{ 0xfc, 0x44, 0x68, 0xff }},
-        {{ 0xcc, 0x00, 0xd8, 0xff }},
-        {{ 0x58, 0x00, 0xe4, 0xff }},
-        {{ 0x00, 0x38, 0xf8, 0xff }},
-        {{ 0x10, 0x5c, 0xe4, 0xff }},
-        /* 0x18 */
-        {{ 0x00, 0x7c, 0xac, 0xff }},
-        {{ 0x00, 0xb8, 0x00, 0xff }},
-        {{ 0x00, 0xa8, 0x00, 0xff }},
-        {{ 0x44, 0xa8, 0x00, 0xff }},
-        {{ 0x88, 0x88, 0x00, 0xff }},
-        {{ 0x00, 0x00, 0x00, 0xff }},
-        {{ 0x00, 0x00, 0x00, 0xff }},
-        {{ 0x00, 0x00, 0x00, 0xff }},
-        /* 0x20 */
-        {{ 0xf8, 0xf8, 0xf8, 0xff }},
-        {{ 0xfc, 0xbc, 0x5d, 0xff }},
-        {{ 0xfc, 0x88, 0x68, 0xff }},
-        {{ 0xf8, 0x78, 0x98, 0xff }},
-        {{ 0xf8, 0x78, 0xf8, 0xff }},
-        {{ 0x98, 0x58, 0xf8, 0xff }},
-        {{ 0x58, 0x78, 0xf8, 0xff }},
-        {{ 0x44, 0xa0, 0xfc, 0xff }},
-        /* 0x28 */
-        {{ 0x00, 0xb8, 0xf8, 0xff }},
-        {{ 0x18, 0xf8, 0xb8, 0xff }},
-        {{ 0x56, 0xd8, 0x58, 0xff }},
-        {{ 0x98, 0xf8, 0x58, 0xff }},
-        {{ 0xd8, 0xe8, 0x00, 0xff }},
-        {{ 0x78, 0x78, 0x78, 0xff }},
-        {{ 0x00, 0x00, 0x00, 0xff }},
-        {{ 0x00, 0x00, 0x00, 0xff }},
-        /* 0x30 */
-        {{ 0xfc, 0xfc, 0xfc, 0xff }},
-        {{ 0xfc, 0xdf, 0xbc, 0xff }},
-        {{ 0xf8, 0xb8, 0xb8, 0xff }},
-        {{ 0xf8, 0xb8, 0xd8, 0xff }},
-        {{ 0xf8, 0xb8, 0xf8, 0xff }},
-        {{ 0xe5, 0xcc, 0xf8, 0xff }},
-        {{ 0xca, 0xcf, 0xf8, 0xff }},
-        {{ 0xb4, 0xd5, 0xf8, 0xff }},
-        /* 0x38 */
-        {{ 0x78, 0xd8, 0xf8, 0xff }},
-        {{ 0x78, 0xf8, 0xd8, 0xff }},
-        {{ 0xb8, 0xf8, 0xb8, 0xff }},
-        {{ 0xd8, 0xf8, 0xb8, 0xff }},
-        {{ 0xfc, 0xfc, 0x00, 0xff }},
-        {{ 0xb6, 0xb6, 0xb6, 0xff }},
-        {{ 0x00, 0x00, 0x00, 0xff }},
-        {{ 0x00, 0x00, 0x00, 0xff }},
-        };
-
-#define PALETTE_MAX 64
-
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
 
+void nes_service_audio_callback(
+	__in void *context,
+	__inout Uint8 *stream,
+	__in int length
+	);
+
 int nes_service_clear(void);
 
+void nes_service_color(
+	__in uint32_t x,
+	__in uint32_t y,
+	__in const nes_color_t *color
+	);
+
+void nes_service_controller(
+	__in int index,
+	__in bool attached
+	);
+
+void nes_service_expand(
+	__inout nes_sdl_frame_t *frame
+	);
+
+int nes_service_frame(
+	__inout nes_sdl_frame_t *source,
+	__inout uint8_t *texture,
+	__in size_t pitch
+	);
+
 int nes_service_fullscreen(void);
 
+void nes_service_pace(void);
+
+int nes_service_present(
+	__inout nes_sdl_frame_t *source
+	);
+
+int nes_service_present_load(void);
+
+void nes_service_present_publish(void);
+
+int nes_service_present_run(
+	__in void *context
+	);
+
+void nes_service_present_unload(void);
+
+uint64_t nes_service_timestamp(void);
+
+void nes_service_timing(void);
+
+int nes_service_timing_compare(
+	__in const void *first,
+	__in const void *second
+	);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
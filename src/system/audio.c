@@ -0,0 +1,775 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./audio_type.h"
+
+static nes_audio_kernel_t g_audio_kernel = { .once = ONCE_FLAG_INIT, };
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void
+nes_audio_acknowledge(
+        __in const nes_audio_t *audio
+        )
+{
+
+        /* The IRQ line is level-triggered, so drop it once neither the frame nor the DMC flag remains set */
+        if(!audio->status.frame_interrupt && !audio->status.dmc_interrupt) {
+                nes_bus_interrupt_clear();
+        }
+}
+
+void
+nes_audio_blip(
+        __inout nes_audio_t *audio,
+        __in uint64_t cycle,
+        __in float delta
+        )
+{
+        uint32_t offset = cycle - audio->blip_cycle;
+        float *blip = &audio->blip[offset / AUDIO_BLIP_DIVIDER];
+        const nes_audio_vector_t *kernel = g_audio_kernel.blip[offset % AUDIO_BLIP_DIVIDER];
+
+        for(uint32_t tap = 0; tap < (AUDIO_BLIP_TAPS / AUDIO_VECTOR_WIDTH); ++tap) {
+                nes_audio_vector_t value;
+
+                memcpy(&value, &blip[tap * AUDIO_VECTOR_WIDTH], sizeof(value));
+                value += kernel[tap] * delta;
+                memcpy(&blip[tap * AUDIO_VECTOR_WIDTH], &value, sizeof(value));
+        }
+}
+
+void
+nes_audio_dmc_fetch(
+        __inout nes_audio_t *audio
+        )
+{
+        nes_audio_dmc_t *dmc = &audio->dmc;
+
+        if(dmc->empty && dmc->remaining) {
+                dmc->buffer = nes_bus_read(BUS_PROCESSOR, dmc->address);
+                dmc->empty = false;
+
+                if(!++dmc->address) {
+                        dmc->address = PROCESSOR_ROM_0_BEGIN;
+                }
+
+                if(!--dmc->remaining) {
+
+                        if(dmc->loop) {
+                                dmc->address = dmc->start;
+                                dmc->remaining = dmc->length;
+                        } else if(dmc->interrupt) {
+                                audio->status.dmc_interrupt = true;
+                                nes_bus_interrupt(true);
+                        }
+                }
+        }
+}
+
+void
+nes_audio_dmc_run(
+        __inout nes_audio_t *audio,
+        __in uint32_t cycles
+        )
+{
+        nes_audio_dmc_t *dmc = &audio->dmc;
+        uint64_t cycle = audio->cycle;
+
+        nes_audio_output(audio, AUDIO_CHANNEL_DMC, dmc->output, cycle);
+
+        while(cycles >= dmc->timer) {
+                cycle += dmc->timer;
+                cycles -= dmc->timer;
+                dmc->timer = dmc->period;
+
+                if(!dmc->silence) {
+
+                        if(dmc->shift & 1) {
+
+                                if(dmc->output <= AUDIO_DMC_OUTPUT_MAX) {
+                                        dmc->output += AUDIO_DMC_OUTPUT_STEP;
+                                }
+                        } else if(dmc->output >= AUDIO_DMC_OUTPUT_MIN) {
+                                dmc->output -= AUDIO_DMC_OUTPUT_STEP;
+                        }
+                }
+
+                dmc->shift >>= 1;
+
+                if(!--dmc->bits) {
+                        dmc->bits = AUDIO_DMC_BITS;
+
+                        if(!(dmc->silence = dmc->empty)) {
+                                dmc->shift = dmc->buffer;
+                                dmc->empty = true;
+                                nes_audio_dmc_fetch(audio);
+                        }
+                }
+
+                nes_audio_output(audio, AUDIO_CHANNEL_DMC, dmc->output, cycle);
+        }
+
+        dmc->timer -= cycles;
+}
+
+void
+nes_audio_envelope(
+        __inout nes_audio_envelope_t *envelope
+        )
+{
+
+        if(envelope->start) {
+                envelope->start = false;
+                envelope->decay = AUDIO_ENVELOPE_MAX;
+                envelope->divider = envelope->control.volume;
+        } else if(envelope->divider) {
+                --envelope->divider;
+        } else {
+                envelope->divider = envelope->control.volume;
+
+                if(envelope->decay) {
+                        --envelope->decay;
+                } else if(envelope->control.halt) {
+                        envelope->decay = AUDIO_ENVELOPE_MAX;
+                }
+        }
+}
+
+void
+nes_audio_event(
+        __inout nes_audio_t *audio
+        )
+{
+        audio->event = AUDIO_EVENT_NONE;
+
+        if((audio->frame.mode == AUDIO_MODE_4_STEP) && !audio->frame.inhibit) {
+                audio->event = audio->cycle + audio->frame.timer;
+
+                for(uint8_t step = audio->frame.step; step < (AUDIO_FRAME_STEPS[AUDIO_MODE_4_STEP] - 1); ++step) {
+                        audio->event += AUDIO_FRAME_DELTA[AUDIO_MODE_4_STEP][step];
+                }
+        }
+
+        if(audio->dmc.interrupt && !audio->dmc.loop && audio->dmc.remaining) {
+                uint64_t event = audio->cycle + audio->dmc.timer + ((audio->dmc.bits - 1) * audio->dmc.period);
+
+                if(event < audio->event) {
+                        audio->event = event;
+                }
+        }
+}
+
+void
+nes_audio_flush(
+        __inout nes_audio_t *audio,
+        __in uint64_t cycle
+        )
+{
+        nes_audio_synchronize(audio, cycle);
+        nes_audio_resample(audio);
+
+        if(!audio->skip) {
+                audio->step = AUDIO_CLOCK / nes_service_audio(audio->sample, audio->sample_count);
+        }
+
+        audio->sample_count = 0;
+}
+
+void
+nes_audio_frame(
+        __inout nes_audio_t *audio,
+        __in uint8_t action
+        )
+{
+
+        if(action & AUDIO_FRAME_QUARTER) {
+                nes_audio_envelope(&audio->pulse[0].envelope);
+                nes_audio_envelope(&audio->pulse[1].envelope);
+                nes_audio_envelope(&audio->noise.envelope);
+
+                if(audio->triangle.linear_reload) {
+                        audio->triangle.linear = audio->triangle.linear_load;
+                } else if(audio->triangle.linear) {
+                        --audio->triangle.linear;
+                }
+
+                if(!audio->triangle.control) {
+                        audio->triangle.linear_reload = false;
+                }
+        }
+
+        if(action & AUDIO_FRAME_HALF) {
+
+                for(uint8_t channel = 0; channel < AUDIO_PULSE_MAX; ++channel) {
+                        nes_audio_pulse_t *pulse = &audio->pulse[channel];
+                        uint16_t target = nes_audio_pulse_target(pulse, channel);
+
+                        nes_audio_length(&pulse->length, pulse->envelope.control.halt);
+
+                        if(!pulse->sweep_divider && pulse->sweep.enabled && pulse->sweep.shift
+                                        && (pulse->period >= AUDIO_PULSE_PERIOD_MIN) && (target <= AUDIO_PULSE_PERIOD_MAX)) {
+                                pulse->period = target;
+                        }
+
+                        if(!pulse->sweep_divider || pulse->sweep_reload) {
+                                pulse->sweep_divider = pulse->sweep.period;
+                                pulse->sweep_reload = false;
+                        } else {
+                                --pulse->sweep_divider;
+                        }
+                }
+
+                nes_audio_length(&audio->triangle.length, audio->triangle.control);
+                nes_audio_length(&audio->noise.length, audio->noise.envelope.control.halt);
+        }
+
+        if((action & AUDIO_FRAME_INTERRUPT) && !audio->frame.inhibit) {
+                audio->status.frame_interrupt = true;
+                nes_bus_interrupt(true);
+        }
+}
+
+void
+nes_audio_initialize(void)
+{
+        float tap[AUDIO_RESAMPLE_TAPS];
+
+        for(uint32_t phase = 0; phase < AUDIO_BLIP_DIVIDER; ++phase) {
+                nes_audio_sinc(tap, AUDIO_BLIP_TAPS, AUDIO_BLIP_CUTOFF, phase / (float)AUDIO_BLIP_DIVIDER);
+                memcpy(g_audio_kernel.blip[phase], tap, sizeof(g_audio_kernel.blip[phase]));
+        }
+
+        for(uint32_t rate = 0; rate < AUDIO_RATE_MAX; ++rate) {
+                float cutoff = (AUDIO_RESAMPLE_CUTOFF * AUDIO_RATE[rate] * AUDIO_BLIP_DIVIDER) / AUDIO_CLOCK;
+
+                for(uint32_t phase = 0; phase < AUDIO_RESAMPLE_PHASES; ++phase) {
+                        nes_audio_sinc(tap, AUDIO_RESAMPLE_TAPS, cutoff, phase / (float)AUDIO_RESAMPLE_PHASES);
+                        memcpy(g_audio_kernel.resample[rate][phase], tap, sizeof(g_audio_kernel.resample[rate][phase]));
+                }
+        }
+}
+
+void
+nes_audio_length(
+        __inout uint8_t *length,
+        __in bool halt
+        )
+{
+
+        if(!halt && *length) {
+                --*length;
+        }
+}
+
+int
+nes_audio_load(
+        __inout nes_audio_t *audio,
+        __in unsigned rate
+        )
+{
+        int result = NES_OK;
+        uint8_t index = 0;
+
+        TRACE(LEVEL_VERBOSE, "%s", "Audio loading");
+
+        if(!rate) {
+                rate = AUDIO_SAMPLE_RATE;
+        }
+
+        while((index < AUDIO_RATE_MAX) && (AUDIO_RATE[index] != rate)) {
+                ++index;
+        }
+
+        if(index == AUDIO_RATE_MAX) {
+                result = ERROR(NES_ERR, "invalid audio sample rate -- %u (expecting %u or %u)", rate, AUDIO_RATE[AUDIO_RATE_44100],
+                        AUDIO_RATE[AUDIO_RATE_48000]);
+                goto exit;
+        }
+
+        audio->rate = index;
+        TRACE(LEVEL_VERBOSE, "Audio loaded: %u Hz", rate);
+
+exit:
+        return result;
+}
+
+void
+nes_audio_noise_run(
+        __inout nes_audio_t *audio,
+        __in uint32_t cycles
+        )
+{
+        nes_audio_noise_t *noise = &audio->noise;
+        uint8_t volume = noise->length ? nes_audio_volume(&noise->envelope) : 0;
+        uint64_t cycle = audio->cycle;
+
+        nes_audio_output(audio, AUDIO_CHANNEL_NOISE, (noise->shift & 1) ? 0 : volume, cycle);
+
+        while(cycles >= noise->timer) {
+                uint16_t feedback = (noise->shift ^ (noise->shift >> (noise->mode ? AUDIO_NOISE_TAP_SHORT : AUDIO_NOISE_TAP_LONG))) & 1;
+
+                cycle += noise->timer;
+                cycles -= noise->timer;
+                noise->timer = noise->period;
+                noise->shift = (noise->shift >> 1) | (feedback << AUDIO_NOISE_SHIFT);
+                nes_audio_output(audio, AUDIO_CHANNEL_NOISE, (noise->shift & 1) ? 0 : volume, cycle);
+        }
+
+        noise->timer -= cycles;
+}
+
+void
+nes_audio_output(
+        __inout nes_audio_t *audio,
+        __in uint8_t channel,
+        __in uint8_t level,
+        __in uint64_t cycle
+        )
+{
+
+        if(level != audio->level[channel]) {
+                nes_audio_blip(audio, cycle, (level - audio->level[channel]) * AUDIO_MIX[channel]);
+                audio->level[channel] = level;
+        }
+}
+
+uint8_t
+nes_audio_port_read(
+        __inout nes_audio_t *audio,
+        __in uint16_t address
+        )
+{
+        uint8_t result = 0;
+
+        switch(address) {
+                case AUDIO_PORT_STATUS:
+                        result = (audio->pulse[0].length ? 0x01 : 0) | (audio->pulse[1].length ? 0x02 : 0) | (audio->triangle.length ? 0x04 : 0)
+                                | (audio->noise.length ? 0x08 : 0) | (audio->dmc.remaining ? 0x10 : 0) | (audio->status.raw & 0xc0);
+                        audio->status.frame_interrupt = false;
+                        nes_audio_acknowledge(audio);
+                        break;
+                default:
+                        TRACE(LEVEL_WARNING, "Invalid audio port read: [%04X]", address);
+                        break;
+        }
+
+        return result;
+}
+
+void
+nes_audio_port_write(
+        __inout nes_audio_t *audio,
+        __in uint16_t address,
+        __in uint8_t data
+        )
+{
+        nes_audio_pulse_t *pulse = &audio->pulse[(address / 4) % AUDIO_PULSE_MAX];
+
+        switch(address) {
+                case AUDIO_PORT_PULSE_1_CONTROL:
+                case AUDIO_PORT_PULSE_2_CONTROL:
+                        pulse->envelope.control.raw = data;
+                        break;
+                case AUDIO_PORT_PULSE_1_SWEEP:
+                case AUDIO_PORT_PULSE_2_SWEEP:
+                        pulse->sweep.raw = data;
+                        pulse->sweep_reload = true;
+                        break;
+                case AUDIO_PORT_PULSE_1_TIMER_LOW:
+                case AUDIO_PORT_PULSE_2_TIMER_LOW:
+                        pulse->period = (pulse->period & 0x0700) | data;
+                        break;
+                case AUDIO_PORT_PULSE_1_TIMER_HIGH:
+                case AUDIO_PORT_PULSE_2_TIMER_HIGH:
+                        pulse->period = (pulse->period & 0x00ff) | ((data & 0x07) << 8);
+
+                        if(audio->status.raw & (1 << (address / 4))) {
+                                pulse->length = AUDIO_LENGTH[data >> 3];
+                        }
+
+                        pulse->envelope.start = true;
+                        pulse->sequence = 0;
+                        break;
+                case AUDIO_PORT_TRIANGLE_CONTROL:
+                        audio->triangle.control = (data & 0x80) != 0;
+                        audio->triangle.linear_load = data & 0x7f;
+                        break;
+                case AUDIO_PORT_TRIANGLE_TIMER_LOW:
+                        audio->triangle.period = (audio->triangle.period & 0x0700) | data;
+                        break;
+                case AUDIO_PORT_TRIANGLE_TIMER_HIGH:
+                        audio->triangle.period = (audio->triangle.period & 0x00ff) | ((data & 0x07) << 8);
+
+                        if(audio->status.triangle) {
+                                audio->triangle.length = AUDIO_LENGTH[data >> 3];
+                        }
+
+                        audio->triangle.linear_reload = true;
+                        break;
+                case AUDIO_PORT_NOISE_CONTROL:
+                        audio->noise.envelope.control.raw = data;
+                        break;
+                case AUDIO_PORT_NOISE_PERIOD:
+                        audio->noise.mode = (data & 0x80) != 0;
+                        audio->noise.period = AUDIO_NOISE_PERIOD[data & 0x0f];
+                        break;
+                case AUDIO_PORT_NOISE_LENGTH:
+
+                        if(audio->status.noise) {
+                                audio->noise.length = AUDIO_LENGTH[data >> 3];
+                        }
+
+                        audio->noise.envelope.start = true;
+                        break;
+                case AUDIO_PORT_DMC_CONTROL:
+                        audio->dmc.interrupt = (data & 0x80) != 0;
+                        audio->dmc.loop = (data & 0x40) != 0;
+                        audio->dmc.period = AUDIO_DMC_PERIOD[data & 0x0f];
+
+                        if(!audio->dmc.interrupt) {
+                                audio->status.dmc_interrupt = false;
+                                nes_audio_acknowledge(audio);
+                        }
+                        break;
+                case AUDIO_PORT_DMC_LOAD:
+                        audio->dmc.output = data & 0x7f;
+                        break;
+                case AUDIO_PORT_DMC_ADDRESS:
+                        audio->dmc.start = AUDIO_DMC_ADDRESS + (data * AUDIO_DMC_ADDRESS_SCALE);
+                        break;
+                case AUDIO_PORT_DMC_LENGTH:
+                        audio->dmc.length = (data * AUDIO_DMC_LENGTH_SCALE) + 1;
+                        break;
+                case AUDIO_PORT_STATUS:
+                        audio->status.raw = (audio->status.raw & 0x40) | (data & 0x1f);
+                        nes_audio_acknowledge(audio);
+
+                        if(!audio->status.pulse_1) {
+                                audio->pulse[0].length = 0;
+                        }
+
+                        if(!audio->status.pulse_2) {
+                                audio->pulse[1].length = 0;
+                        }
+
+                        if(!audio->status.triangle) {
+                                audio->triangle.length = 0;
+                        }
+
+                        if(!audio->status.noise) {
+                                audio->noise.length = 0;
+                        }
+
+                        if(!audio->status.dmc) {
+                                audio->dmc.remaining = 0;
+                        } else if(!audio->dmc.remaining) {
+                                audio->dmc.address = audio->dmc.start;
+                                audio->dmc.remaining = audio->dmc.length;
+                                nes_audio_dmc_fetch(audio);
+                        }
+                        break;
+                case AUDIO_PORT_FRAME:
+                        audio->frame.inhibit = (data & 0x40) != 0;
+                        audio->frame.mode = (data & 0x80) ? AUDIO_MODE_5_STEP : AUDIO_MODE_4_STEP;
+                        audio->frame.step = 0;
+                        audio->frame.timer = AUDIO_FRAME_RESET;
+
+                        if(audio->frame.inhibit) {
+                                audio->status.frame_interrupt = false;
+                                nes_audio_acknowledge(audio);
+                        }
+
+                        if(audio->frame.mode == AUDIO_MODE_5_STEP) {
+                                nes_audio_frame(audio, AUDIO_FRAME_QUARTER | AUDIO_FRAME_HALF);
+                        }
+                        break;
+                case AUDIO_PORT_TRIANGLE_UNUSED:
+                case AUDIO_PORT_NOISE_UNUSED:
+                        break;
+                default:
+                        TRACE(LEVEL_WARNING, "Invalid audio port write: [%04X]<-%02X", address, data);
+                        break;
+        }
+
+        nes_audio_event(audio);
+}
+
+void
+nes_audio_pulse_run(
+        __inout nes_audio_t *audio,
+        __in uint8_t channel,
+        __in uint32_t cycles
+        )
+{
+        uint8_t volume = 0;
+        nes_audio_pulse_t *pulse = &audio->pulse[channel];
+        uint32_t period = (pulse->period + 1) * 2;
+
+        if(pulse->length && (pulse->period >= AUDIO_PULSE_PERIOD_MIN) && (nes_audio_pulse_target(pulse, channel) <= AUDIO_PULSE_PERIOD_MAX)) {
+                volume = nes_audio_volume(&pulse->envelope);
+        }
+
+        if(volume) {
+                const uint8_t *duty = AUDIO_PULSE_DUTY[pulse->envelope.control.duty];
+                uint64_t cycle = audio->cycle;
+
+                nes_audio_output(audio, AUDIO_CHANNEL_PULSE_1 + channel, duty[pulse->sequence] ? volume : 0, cycle);
+
+                while(cycles >= pulse->timer) {
+                        cycle += pulse->timer;
+                        cycles -= pulse->timer;
+                        pulse->timer = period;
+                        pulse->sequence = (pulse->sequence + 1) % AUDIO_PULSE_SEQUENCE;
+                        nes_audio_output(audio, AUDIO_CHANNEL_PULSE_1 + channel, duty[pulse->sequence] ? volume : 0, cycle);
+                }
+
+                pulse->timer -= cycles;
+        } else {
+                pulse->sequence = (pulse->sequence + nes_audio_timer(&pulse->timer, period, cycles)) % AUDIO_PULSE_SEQUENCE;
+                nes_audio_output(audio, AUDIO_CHANNEL_PULSE_1 + channel, 0, audio->cycle);
+        }
+}
+
+uint16_t
+nes_audio_pulse_target(
+        __in const nes_audio_pulse_t *pulse,
+        __in uint8_t channel
+        )
+{
+        int32_t result = pulse->period >> pulse->sweep.shift;
+
+        if(pulse->sweep.negate) {
+                result = pulse->period - result - (channel ? 0 : 1);
+        } else {
+                result = pulse->period + result;
+        }
+
+        return (result > 0) ? result : 0;
+}
+
+void
+nes_audio_resample(
+        __inout nes_audio_t *audio
+        )
+{
+        uint32_t count = (audio->cycle - audio->blip_cycle) / AUDIO_BLIP_DIVIDER, index;
+        uint64_t denominator = AUDIO_BLIP_DIVIDER * AUDIO_RATE[audio->rate];
+
+        for(index = 0; index < count; ++index) {
+                audio->blip_level += audio->blip[index];
+                audio->resample[audio->resample_count++] = audio->blip_level;
+        }
+
+        memmove(audio->blip, &audio->blip[count], AUDIO_BLIP_TAPS * sizeof(*audio->blip));
+        memset(&audio->blip[AUDIO_BLIP_TAPS], 0, count * sizeof(*audio->blip));
+        audio->blip_cycle += count * AUDIO_BLIP_DIVIDER;
+
+        while(((index = audio->resample_position / denominator) + AUDIO_RESAMPLE_TAPS) <= audio->resample_count) {
+                const nes_audio_vector_t *kernel = g_audio_kernel.resample[audio->rate][((audio->resample_position % denominator)
+                        * AUDIO_RESAMPLE_PHASES) / denominator];
+                float output = 0.f;
+                nes_audio_vector_t sum = {};
+
+                for(uint32_t tap = 0; tap < (AUDIO_RESAMPLE_TAPS / AUDIO_VECTOR_WIDTH); ++tap) {
+                        nes_audio_vector_t value;
+
+                        memcpy(&value, &audio->resample[index + (tap * AUDIO_VECTOR_WIDTH)], sizeof(value));
+                        sum += value * kernel[tap];
+                }
+
+                for(uint32_t lane = 0; lane < AUDIO_VECTOR_WIDTH; ++lane) {
+                        output += sum[lane];
+                }
+
+                audio->filter[1] = (output - audio->filter[0]) + (AUDIO_FILTER_POLE * audio->filter[1]);
+                audio->filter[0] = output;
+
+                if(audio->sample_count < AUDIO_SAMPLE_MAX) {
+                        output = audio->filter[1] * INT16_MAX;
+                        audio->sample[audio->sample_count++] = (output > INT16_MAX) ? INT16_MAX : ((output < INT16_MIN) ? INT16_MIN : output);
+                }
+
+                audio->resample_position += audio->step;
+        }
+
+        memmove(audio->resample, &audio->resample[index], (audio->resample_count - index) * sizeof(*audio->resample));
+        audio->resample_count -= index;
+        audio->resample_position -= index * denominator;
+}
+
+void
+nes_audio_reset(
+        __inout nes_audio_t *audio
+        )
+{
+        TRACE(LEVEL_VERBOSE, "%s", "Audio reset");
+        memset(audio, 0, sizeof(*audio));
+        audio->dmc.bits = AUDIO_DMC_BITS;
+        audio->dmc.empty = true;
+        audio->dmc.period = AUDIO_DMC_PERIOD[0];
+        audio->dmc.silence = true;
+        audio->dmc.timer = audio->dmc.period;
+        audio->frame.timer = AUDIO_FRAME_RESET;
+        audio->noise.period = AUDIO_NOISE_PERIOD[0];
+        audio->noise.shift = 1;
+        audio->noise.timer = audio->noise.period;
+        audio->step = AUDIO_CLOCK;
+
+        for(uint8_t channel = 0; channel < AUDIO_PULSE_MAX; ++channel) {
+                audio->pulse[channel].timer = (audio->pulse[channel].period + 1) * 2;
+        }
+
+        audio->triangle.timer = audio->triangle.period + 1;
+        audio->level[AUDIO_CHANNEL_TRIANGLE] = AUDIO_TRIANGLE[audio->triangle.sequence];
+        call_once(&g_audio_kernel.once, nes_audio_initialize);
+        nes_audio_event(audio);
+}
+
+void
+nes_audio_sinc(
+        __inout float *tap,
+        __in uint32_t taps,
+        __in float cutoff,
+        __in float offset
+        )
+{
+        float sum = 0.f;
+
+        for(uint32_t index = 0; index < taps; ++index) {
+                float position = index - ((taps / 2.f) - 1.f) - offset, window = (position + (taps / 2.f)) / taps;
+
+                tap[index] = 0.42f - (0.5f * cosf(2.f * AUDIO_PI * window)) + (0.08f * cosf(4.f * AUDIO_PI * window));
+                tap[index] *= position ? (sinf(2.f * AUDIO_PI * cutoff * position) / (AUDIO_PI * position)) : (2.f * cutoff);
+                sum += tap[index];
+        }
+
+        for(uint32_t index = 0; index < taps; ++index) {
+                tap[index] /= sum;
+        }
+}
+
+void
+nes_audio_synchronize(
+        __inout nes_audio_t *audio,
+        __in uint64_t cycle
+        )
+{
+
+        while(cycle > audio->cycle) {
+                uint32_t cycles;
+
+                if((audio->cycle - audio->blip_cycle) >= (AUDIO_BLIP_CYCLES - 1)) {
+                        nes_audio_resample(audio);
+                }
+
+                cycles = (AUDIO_BLIP_CYCLES - 1) - (audio->cycle - audio->blip_cycle);
+
+                if((cycle - audio->cycle) < cycles) {
+                        cycles = cycle - audio->cycle;
+                }
+
+                if(audio->frame.timer < cycles) {
+                        cycles = audio->frame.timer;
+                }
+
+                for(uint8_t channel = 0; channel < AUDIO_PULSE_MAX; ++channel) {
+                        nes_audio_pulse_run(audio, channel, cycles);
+                }
+
+                nes_audio_triangle_run(audio, cycles);
+                nes_audio_noise_run(audio, cycles);
+                nes_audio_dmc_run(audio, cycles);
+                audio->cycle += cycles;
+
+                if(!(audio->frame.timer -= cycles)) {
+                        uint8_t action = AUDIO_FRAME_ACTION[audio->frame.mode][audio->frame.step];
+
+                        audio->frame.timer = AUDIO_FRAME_DELTA[audio->frame.mode][audio->frame.step];
+                        audio->frame.step = (audio->frame.step + 1) % AUDIO_FRAME_STEPS[audio->frame.mode];
+                        nes_audio_frame(audio, action);
+                }
+        }
+
+        nes_audio_event(audio);
+}
+
+uint32_t
+nes_audio_timer(
+        __inout uint32_t *timer,
+        __in uint32_t period,
+        __in uint32_t cycles
+        )
+{
+        uint32_t result = 0;
+
+        if(cycles < *timer) {
+                *timer -= cycles;
+        } else {
+                cycles -= *timer;
+                result = 1 + (cycles / period);
+                *timer = period - (cycles % period);
+        }
+
+        return result;
+}
+
+void
+nes_audio_triangle_run(
+        __inout nes_audio_t *audio,
+        __in uint32_t cycles
+        )
+{
+        nes_audio_triangle_t *triangle = &audio->triangle;
+        uint32_t period = triangle->period + 1;
+
+        if(triangle->length && triangle->linear && (triangle->period >= AUDIO_TRIANGLE_PERIOD_MIN)) {
+                uint64_t cycle = audio->cycle;
+
+                nes_audio_output(audio, AUDIO_CHANNEL_TRIANGLE, AUDIO_TRIANGLE[triangle->sequence], cycle);
+
+                while(cycles >= triangle->timer) {
+                        cycle += triangle->timer;
+                        cycles -= triangle->timer;
+                        triangle->timer = period;
+                        triangle->sequence = (triangle->sequence + 1) % AUDIO_TRIANGLE_SEQUENCE;
+                        nes_audio_output(audio, AUDIO_CHANNEL_TRIANGLE, AUDIO_TRIANGLE[triangle->sequence], cycle);
+                }
+
+                triangle->timer -= cycles;
+        } else {
+                nes_audio_timer(&triangle->timer, period, cycles);
+        }
+}
+
+uint8_t
+nes_audio_volume(
+        __in const nes_audio_envelope_t *envelope
+        )
+{
+        return envelope->control.constant ? envelope->control.volume : envelope->decay;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,254 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NES_AUDIO_TYPE_H_
+#define NES_AUDIO_TYPE_H_
+
+#include <math.h>
+#include <threads.h>
+#include "../../include/system/audio.h"
+#include "../../include/service.h"
+
+#define AUDIO_BLIP_CUTOFF 0.4f
+#define AUDIO_BLIP_CYCLES (AUDIO_BLIP_MAX * AUDIO_BLIP_DIVIDER)
+#define AUDIO_BLIP_DIVIDER 16
+
+#define AUDIO_CLOCK 1789773
+
+#define AUDIO_DMC_ADDRESS 0xc000
+#define AUDIO_DMC_ADDRESS_SCALE 64
+#define AUDIO_DMC_BITS 8
+#define AUDIO_DMC_LENGTH_SCALE 16
+#define AUDIO_DMC_OUTPUT_MAX 125
+#define AUDIO_DMC_OUTPUT_MIN 2
+#define AUDIO_DMC_OUTPUT_STEP 2
+
+#define AUDIO_ENVELOPE_MAX 15
+
+#define AUDIO_EVENT_NONE UINT64_MAX
+
+#define AUDIO_FILTER_POLE 0.996f
+
+#define AUDIO_FRAME_HALF 0x02
+#define AUDIO_FRAME_INTERRUPT 0x04
+#define AUDIO_FRAME_QUARTER 0x01
+#define AUDIO_FRAME_RESET 7457
+
+#define AUDIO_NOISE_SHIFT 14
+#define AUDIO_NOISE_TAP_LONG 1
+#define AUDIO_NOISE_TAP_SHORT 6
+
+#define AUDIO_PI 3.14159265f
+
+#define AUDIO_PULSE_MAX 2
+#define AUDIO_PULSE_PERIOD_MAX 0x07ff
+#define AUDIO_PULSE_PERIOD_MIN 8
+#define AUDIO_PULSE_SEQUENCE 8
+
+#define AUDIO_RESAMPLE_CUTOFF 0.4f
+#define AUDIO_RESAMPLE_PHASES 64
+
+#define AUDIO_TRIANGLE_PERIOD_MIN 2
+#define AUDIO_TRIANGLE_SEQUENCE 32
+
+#define AUDIO_VECTOR_WIDTH 8
+
+enum {
+        AUDIO_RATE_44100 = 0,
+        AUDIO_RATE_48000,
+        AUDIO_RATE_MAX,
+};
+
+typedef float nes_audio_vector_t __attribute__((vector_size(AUDIO_VECTOR_WIDTH * sizeof(float))));
+
+typedef struct {
+        nes_audio_vector_t blip[AUDIO_BLIP_DIVIDER][AUDIO_BLIP_TAPS / AUDIO_VECTOR_WIDTH];
+        once_flag once;
+        nes_audio_vector_t resample[AUDIO_RATE_MAX][AUDIO_RESAMPLE_PHASES][AUDIO_RESAMPLE_TAPS / AUDIO_VECTOR_WIDTH];
+} nes_audio_kernel_t;
+
+enum {
+        AUDIO_MODE_4_STEP = 0,
+        AUDIO_MODE_5_STEP,
+        AUDIO_MODE_MAX,
+};
+
+static const uint16_t AUDIO_DMC_PERIOD[] = {
+        428, 380, 340, 320, 286, 254, 226, 214, 190, 160, 142, 128, 106, 84, 72, 54,
+        };
+
+static const uint8_t AUDIO_FRAME_ACTION[AUDIO_MODE_MAX][5] = {
+        { /* AUDIO_MODE_4_STEP */
+                AUDIO_FRAME_QUARTER,
+                AUDIO_FRAME_QUARTER | AUDIO_FRAME_HALF,
+                AUDIO_FRAME_QUARTER,
+                AUDIO_FRAME_QUARTER | AUDIO_FRAME_HALF | AUDIO_FRAME_INTERRUPT,
+                },
+        { /* AUDIO_MODE_5_STEP */
+                AUDIO_FRAME_QUARTER,
+                AUDIO_FRAME_QUARTER | AUDIO_FRAME_HALF,
+                AUDIO_FRAME_QUARTER,
+                0,
+                AUDIO_FRAME_QUARTER | AUDIO_FRAME_HALF,
+                },
+        };
+
+static const uint16_t AUDIO_FRAME_DELTA[AUDIO_MODE_MAX][5] = {
+        { 7456, 7458, 7458, 7458, }, /* AUDIO_MODE_4_STEP */
+        { 7456, 7458, 7458, 7452, 7458, }, /* AUDIO_MODE_5_STEP */
+        };
+
+static const uint8_t AUDIO_FRAME_STEPS[] = {
+        4, /* AUDIO_MODE_4_STEP */
+        5, /* AUDIO_MODE_5_STEP */
+        };
+
+static const uint8_t AUDIO_LENGTH[] = {
+        10, 254, 20, 2, 40, 4, 80, 6, 160, 8, 60, 10, 14, 12, 26, 14,
+        12, 16, 24, 18, 48, 20, 96, 22, 192, 24, 72, 26, 16, 28, 32, 30,
+        };
+
+static const float AUDIO_MIX[] = {
+        0.00752f, /* AUDIO_CHANNEL_PULSE_1 */
+        0.00752f, /* AUDIO_CHANNEL_PULSE_2 */
+        0.00851f, /* AUDIO_CHANNEL_TRIANGLE */
+        0.00494f, /* AUDIO_CHANNEL_NOISE */
+        0.00335f, /* AUDIO_CHANNEL_DMC */
+        };
+
+static const uint16_t AUDIO_NOISE_PERIOD[] = {
+        4, 8, 16, 32, 64, 96, 128, 160, 202, 254, 380, 508, 762, 1016, 2034, 4068,
+        };
+
+static const uint8_t AUDIO_PULSE_DUTY[][AUDIO_PULSE_SEQUENCE] = {
+        { 0, 1, 0, 0, 0, 0, 0, 0, }, /* 12.5% */
+        { 0, 1, 1, 0, 0, 0, 0, 0, }, /* 25% */
+        { 0, 1, 1, 1, 1, 0, 0, 0, }, /* 50% */
+        { 1, 0, 0, 1, 1, 1, 1, 1, }, /* 25% (negated) */
+        };
+
+static const unsigned AUDIO_RATE[] = {
+        44100, /* AUDIO_RATE_44100 */
+        48000, /* AUDIO_RATE_48000 */
+        };
+
+static const uint8_t AUDIO_TRIANGLE[AUDIO_TRIANGLE_SEQUENCE] = {
+        15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        };
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void nes_audio_acknowledge(
+        __in const nes_audio_t *audio
+        );
+
+void nes_audio_blip(
+        __inout nes_audio_t *audio,
+        __in uint64_t cycle,
+        __in float delta
+        );
+
+void nes_audio_dmc_fetch(
+        __inout nes_audio_t *audio
+        );
+
+void nes_audio_dmc_run(
+        __inout nes_audio_t *audio,
+        __in uint32_t cycles
+        );
+
+void nes_audio_envelope(
+        __inout nes_audio_envelope_t *envelope
+        );
+
+void nes_audio_event(
+        __inout nes_audio_t *audio
+        );
+
+void nes_audio_frame(
+        __inout nes_audio_t *audio,
+        __in uint8_t action
+        );
+
+void nes_audio_initialize(void);
+
+void nes_audio_length(
+        __inout uint8_t *length,
+        __in bool halt
+        );
+
+void nes_audio_noise_run(
+        __inout nes_audio_t *audio,
+        __in uint32_t cycles
+        );
+
+void nes_audio_output(
+        __inout nes_audio_t *audio,
+        __in uint8_t channel,
+        __in uint8_t level,
+        __in uint64_t cycle
+        );
+
+void nes_audio_pulse_run(
+        __inout nes_audio_t *audio,
+        __in uint8_t channel,
+        __in uint32_t cycles
+        );
+
+uint16_t nes_audio_pulse_target(
+        __in const nes_audio_pulse_t *pulse,
+        __in uint8_t channel
+        );
+
+void nes_audio_resample(
+        __inout nes_audio_t *audio
+        );
+
+void nes_audio_sinc(
+        __inout float *tap,
+        __in uint32_t taps,
+        __in float cutoff,
+        __in float offset
+        );
+
+uint32_t nes_audio_timer(
+        __inout uint32_t *timer,
+        __in uint32_t period,
+        __in uint32_t cycles
+        );
+
+void nes_audio_triangle_run(
+        __inout nes_audio_t *audio,
+        __in uint32_t cycles
+        );
+
+uint8_t nes_audio_volume(
+        __in const nes_audio_envelope_t *envelope
+        );
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NES_AUDIO_TYPE_H_ */
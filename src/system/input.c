@@ -0,0 +1,76 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./input_type.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+uint8_t
+nes_input_port_read(
+        __inout nes_input_t *input,
+        __in uint8_t controller
+        )
+{
+        uint8_t result = INPUT_OPEN_BUS;
+
+        if(controller < NES_CONTROLLER_MAX) {
+
+                if(input->strobe) {
+                        input->shift[controller] = input->state[controller];
+                }
+
+                result |= input->shift[controller] & 1;
+                input->shift[controller] = (input->shift[controller] >> 1) | INPUT_SHIFT_FILL;
+        } else {
+                TRACE(LEVEL_WARNING, "Invalid input port read: %u", controller);
+        }
+
+        return result;
+}
+
+void
+nes_input_port_write(
+        __inout nes_input_t *input,
+        __in uint8_t data
+        )
+{
+
+        if(input->strobe || (data & 1)) {
+                memcpy(input->shift, input->state, sizeof(input->shift));
+        }
+
+        input->strobe = data & 1;
+}
+
+void
+nes_input_reset(
+        __inout nes_input_t *input
+        )
+{
+        TRACE(LEVEL_VERBOSE, "%s", "Input reset");
+        memset(input, 0, sizeof(*input));
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
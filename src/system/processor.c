@@ -790,6 +790,14 @@ nes_processor_interrupt(
         }
 }
 
+void
+nes_processor_interrupt_clear(
+        __inout nes_processor_t *processor
+        )
+{
+        processor->pending.maskable = false;
+}
+
 void
 nes_processor_interrupt_maskable(
         __inout nes_processor_t *processor
@@ -803,7 +811,6 @@ nes_processor_interrupt_maskable(
         nes_processor_push(processor, status.low);
         processor->program_counter.word = nes_processor_read_word(processor, MASKABLE_ADDRESS);
         processor->status.interrupt_disabled = true;
-        processor->pending.maskable = false;
         processor->cycles = MASKABLE_CYCLES;
 }
 
@@ -905,6 +912,7 @@ nes_processor_step(
                         nes_processor_transfer_byte(processor);
                 } else {
 
+                        /* The maskable line is sampled as a level, it stays asserted until its source acknowledges it */
                         if(processor->pending.non_maskable) {
                                 nes_processor_interrupt_non_maskable(processor);
                         } else if(processor->pending.maskable && !processor->status.interrupt_disabled) {
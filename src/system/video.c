@@ -25,21 +25,161 @@
 extern "C" {
 #endif /* __cplusplus */
 
+uint8_t
+nes_video_background(
+        __inout nes_video_t *video,
+        __in uint16_t x,
+        __in uint16_t scanline
+        )
+{
+        uint8_t attribute, bit, result = 0, tile;
+        uint16_t base, pattern, tile_x, tile_y;
+        uint16_t position_x = (x + video->scroll_x.low + ((video->control.name_table % 2) * VIDEO_WIDTH)) % (VIDEO_WIDTH * 2);
+        uint16_t position_y = (scanline + video->scroll_y.low + ((video->control.name_table / 2) * VIDEO_HEIGHT)) % (VIDEO_HEIGHT * 2);
+
+        tile_x = (position_x % VIDEO_WIDTH) / VIDEO_TILE_WIDTH;
+        tile_y = (position_y % VIDEO_HEIGHT) / VIDEO_TILE_WIDTH;
+        base = VIDEO_RAM_BEGIN + ((((position_y / VIDEO_HEIGHT) * 2) + (position_x / VIDEO_WIDTH)) * VIDEO_NAME_TABLE_WIDTH);
+        tile = nes_video_read(video, base + (tile_y * (VIDEO_WIDTH / VIDEO_TILE_WIDTH)) + tile_x);
+        pattern = (video->control.background_pattern_table * VIDEO_PATTERN_TABLE_WIDTH) + (tile * VIDEO_TILE_BYTES) + (position_y % VIDEO_TILE_WIDTH);
+        bit = (VIDEO_TILE_WIDTH - 1) - (position_x % VIDEO_TILE_WIDTH);
+
+        if((result = ((nes_video_read(video, pattern) >> bit) & 1) | (((nes_video_read(video, pattern + VIDEO_TILE_WIDTH) >> bit) & 1) << 1))) {
+                attribute = nes_video_read(video, base + VIDEO_ATTRIBUTE_OFFSET + ((tile_y / 4) * VIDEO_TILE_WIDTH) + (tile_x / 4));
+                result |= ((attribute >> (((tile_y & 2) << 1) | (tile_x & 2))) & 3) << 2;
+        }
+
+        return result;
+}
+
+void
+nes_video_evaluate(
+        __inout nes_video_t *video,
+        __in uint16_t scanline
+        )
+{
+        uint8_t count = 0;
+
+        if(!video->mask.sprite_show) {
+                return;
+        }
+
+        for(uint8_t index = 0; index < VIDEO_SPRITE_COUNT; ++index) {
+                uint8_t row;
+                nes_video_sprite_t sprite = {};
+
+                if(!nes_video_sprite(video, index, scanline, &sprite, &row)) {
+                        continue;
+                }
+
+                if(count++ == VIDEO_SPRITE_MAX) {
+                        video->status.sprite_overflow = true;
+                        break;
+                }
+        }
+}
+
+uint32_t
+nes_video_event(
+        __in uint32_t position
+        )
+{
+        uint32_t result;
+
+        if(position < VIDEO_EVENT_RENDER) {
+
+                if((result = ((position / VIDEO_DOTS) * VIDEO_DOTS) + VIDEO_WIDTH) <= position) {
+                        result += VIDEO_DOTS;
+                }
+
+                if(result > VIDEO_EVENT_RENDER) {
+                        result = VIDEO_EVENT_VBLANK;
+                }
+        } else if(position < VIDEO_EVENT_VBLANK) {
+                result = VIDEO_EVENT_VBLANK;
+        } else if(position < VIDEO_EVENT_PRERENDER) {
+                result = VIDEO_EVENT_PRERENDER;
+        } else {
+                result = VIDEO_EVENT_FRAME;
+        }
+
+        return result;
+}
+
+void
+nes_video_invalidate(
+        __inout nes_video_t *video,
+        __in uint16_t address
+        )
+{
+
+        if(video->surface) {
+                nes_video_surface_write(video->surface, address);
+        }
+}
+
+void
+nes_video_mask(
+        __inout nes_video_t *video,
+        __in uint8_t data
+        )
+{
+        video->mask.raw = data;
+        video->color = ((data << 1) & VIDEO_COLOR_EMPHASIS) | (video->mask.grayscale ? VIDEO_COLOR_GRAYSCALE : 0);
+}
+
+uint16_t
+nes_video_mirror(
+        __in uint16_t address
+        )
+{
+        uint16_t result = address % VIDEO_ADDRESS_MIRROR;
+
+        switch(result) {
+                case VIDEO_RAM_BEGIN ... VIDEO_RAM_END: /* 0x2000 - 0x3eff */
+                        result = VIDEO_RAM_BEGIN + ((result - VIDEO_RAM_BEGIN) % VIDEO_RAM_MIRROR);
+                        break;
+                case VIDEO_PALETTE_RAM_BEGIN ... VIDEO_PALETTE_RAM_END: /* 0x3f00 - 0x3fff */
+                        result = VIDEO_PALETTE_RAM_BEGIN + ((result - VIDEO_PALETTE_RAM_BEGIN) % VIDEO_PALETTE_RAM_MIRROR);
+                        break;
+                default: /* 0x0000 - 0x1fff */
+                        break;
+        }
+
+        return result;
+}
+
 uint8_t
 nes_video_object_read(
-        __inout nes_video_t *video
+        __inout nes_video_t *video,
+        __in uint8_t address
         )
 {
-        return nes_bus_read(BUS_OBJECT, video->object_address.low);
+        return video->shadow ? video->shadow->object[address] : nes_bus_read(BUS_OBJECT, address);
 }
 
 void
 nes_video_object_write(
         __inout nes_video_t *video,
+        __in uint8_t address,
         __in uint8_t data
         )
 {
-        nes_bus_write(BUS_OBJECT, video->object_address.low, data);
+        nes_bus_write(BUS_OBJECT, address, data);
+        video->predict = true;
+
+        if(video->pipeline) {
+                nes_video_pipeline_push(video->pipeline, VIDEO_ENTRY_OBJECT, address, data, video->cycle);
+        }
+}
+
+uint8_t
+nes_video_palette(
+        __inout nes_video_t *video,
+        __in uint8_t index
+        )
+{
+        return nes_video_read(video, VIDEO_PALETTE_RAM_BEGIN + ((index % 4) ? index : 0)) & VIDEO_PALETTE_MASK;
 }
 
 uint8_t
@@ -57,7 +197,7 @@ nes_video_port_read(
                         video->address_latch = false;
                         break;
                 case VIDEO_PORT_OBJECT_DATA: /* 0x2004 */
-                        result = video->object_data.low = nes_video_object_read(video);
+                        result = video->object_data.low = nes_video_object_read(video, video->object_address.low);
                         break;
                 case VIDEO_PORT_DATA: /* 0x2007 */
 
@@ -90,23 +230,42 @@ nes_video_port_write(
         __in uint8_t data
         )
 {
+        nes_video_control_t control = { .raw = data };
 
         switch(address) {
                case VIDEO_PORT_CONTROL: /* 0x2000 */
-                        video->control.raw = data;
+                        nes_video_split(video);
+
+                        if(!video->control.interrupt && control.interrupt && video->status.vblank) {
+                                nes_bus_interrupt(false);
+                        }
+
+                        video->control.raw = control.raw;
+                        video->predict = true;
+
+                        if(video->pipeline) {
+                                nes_video_pipeline_push(video->pipeline, VIDEO_ENTRY_CONTROL, address, data, video->cycle);
+                        }
                         break;
                 case VIDEO_PORT_MASK: /* 0x2001 */
-                        video->mask.raw = data;
+                        nes_video_split(video);
+                        nes_video_mask(video, data);
+                        video->predict = true;
+
+                        if(video->pipeline) {
+                                nes_video_pipeline_push(video->pipeline, VIDEO_ENTRY_MASK, address, data, video->cycle);
+                        }
                         break;
                 case VIDEO_PORT_OBJECT_ADDRESS: /* 0x2003 */
                         video->object_address.low = data;
                         break;
                 case VIDEO_PORT_OBJECT_DATA: /* 0x2004 */
-                        nes_video_object_write(video, data);
+                        nes_video_object_write(video, video->object_address.low, data);
                         video->object_data.low = data;
                         ++video->object_address.low;
                         break;
                 case VIDEO_PORT_SCROLL: /* 0x2005 */
+                        nes_video_split(video);
 
                         if(!video->address_latch) {
                                 video->scroll_x.low = data;
@@ -114,9 +273,16 @@ nes_video_port_write(
                                 video->scroll_y.low = data;
                         }
 
+                        if(video->pipeline) {
+                                nes_video_pipeline_push(video->pipeline, video->address_latch ? VIDEO_ENTRY_SCROLL_Y : VIDEO_ENTRY_SCROLL_X, address,
+                                        data, video->cycle);
+                        }
+
                         video->address_latch = !video->address_latch;
+                        video->predict = true;
                         break;
                 case VIDEO_PORT_ADDRESS: /* 0x2006 */
+                        nes_video_split(video);
 
                         if(!video->address_latch) {
                                 video->address.high = data;
@@ -128,6 +294,7 @@ nes_video_port_write(
                         video->address_latch = !video->address_latch;
                         break;
                 case VIDEO_PORT_DATA: /* 0x2007 */
+                        nes_video_split(video);
                         nes_video_write(video, video->address.word, data);
                         video->address.word += VIDEO_INCREMENT[video->control.increment];
                         video->address.word %= VIDEO_ADDRESS_MIRROR;
@@ -138,13 +305,267 @@ nes_video_port_write(
         }
 }
 
+void
+nes_video_predict(
+        __inout nes_video_t *video,
+        __in uint32_t position
+        )
+{
+        uint8_t height, row;
+        nes_video_sprite_t sprite = {};
+
+        video->hit = 0;
+        video->predict = false;
+
+        if(video->status.sprite_0_hit || !video->mask.background_show || !video->mask.sprite_show) {
+                return;
+        }
+
+        sprite.y = nes_video_object_read(video, 0);
+        height = video->control.sprite_size ? (VIDEO_TILE_WIDTH * 2) : VIDEO_TILE_WIDTH;
+
+        if((((sprite.y + height + 1) * VIDEO_DOTS) <= position) || ((sprite.y + 1) >= VIDEO_HEIGHT)) {
+                return;
+        }
+
+        for(uint16_t scanline = sprite.y + 1; (scanline < (sprite.y + 1 + height)) && (scanline < VIDEO_HEIGHT); ++scanline) {
+                uint8_t high, low;
+                uint16_t pattern;
+
+                if((((scanline + 1) * VIDEO_DOTS) <= position) || !nes_video_sprite(video, 0, scanline, &sprite, &row)) {
+                        continue;
+                }
+
+                pattern = nes_video_sprite_pattern(video, &sprite, row);
+                low = nes_video_read(video, pattern);
+                high = nes_video_read(video, pattern + VIDEO_TILE_WIDTH);
+
+                for(uint8_t column = 0; column < VIDEO_TILE_WIDTH; ++column) {
+                        uint8_t bit = sprite.attribute.flip_horizontal ? column : ((VIDEO_TILE_WIDTH - 1) - column);
+                        uint16_t x = sprite.x + column;
+                        uint32_t hit = (scanline * VIDEO_DOTS) + x + 1;
+
+                        if((hit < position) || (x >= (VIDEO_WIDTH - 1))
+                                        || ((x < VIDEO_TILE_WIDTH) && (!video->mask.sprite_show_top || !video->mask.background_show_top))
+                                        || !(((low >> bit) & 1) | (((high >> bit) & 1) << 1))
+                                        || !(nes_video_background(video, x, scanline) % 4)) {
+                                continue;
+                        }
+
+                        if(hit == position) {
+                                video->status.sprite_0_hit = true;
+                        } else {
+                                video->hit = hit;
+                        }
+
+                        return;
+                }
+        }
+}
+
 uint8_t
 nes_video_read(
         __inout nes_video_t *video,
         __in uint16_t address
         )
 {
-        return nes_bus_read(BUS_VIDEO, address);
+        return video->shadow ? video->shadow->memory[nes_video_mirror(address)] : nes_bus_read(BUS_VIDEO, address);
+}
+
+void
+nes_video_render(
+        __inout nes_video_t *video,
+        __in uint16_t scanline
+        )
+{
+        nes_video_render_span(video, scanline, VIDEO_WIDTH);
+        video->span = 0;
+}
+
+void
+nes_video_render_background(
+        __inout nes_video_t *video,
+        __in uint16_t scanline,
+        __in uint16_t begin,
+        __in uint16_t end
+        )
+{
+
+        if(!video->mask.background_show_top && (begin < VIDEO_TILE_WIDTH)) {
+                begin = VIDEO_TILE_WIDTH;
+        }
+
+        for(uint16_t x = begin; x < end; ++x) {
+                video->line[x] = nes_video_background(video, x, scanline);
+        }
+}
+
+void
+nes_video_render_blank(
+        __inout nes_video_t *video,
+        __in uint16_t scanline,
+        __in uint16_t begin,
+        __in uint16_t end
+        )
+{
+        uint16_t color = nes_video_palette(video, 0) | video->color;
+
+        if(video->frame_buffer) {
+
+                for(uint16_t x = begin; x < end; ++x) {
+                        video->frame_buffer[scanline][x] = color;
+                }
+        } else {
+
+                for(uint16_t x = begin; x < end; ++x) {
+                        nes_service_pixel(color, x, scanline);
+                }
+        }
+}
+
+void
+nes_video_render_span(
+        __inout nes_video_t *video,
+        __in uint16_t scanline,
+        __in uint16_t end
+        )
+{
+        uint16_t begin = video->span;
+
+        if(!begin) {
+                memset(video->line, 0, sizeof(video->line));
+        }
+
+        if(!video->mask.background_show && !video->mask.sprite_show) {
+                nes_video_render_blank(video, scanline, begin, end);
+                video->span = end;
+                return;
+        }
+
+        if(video->mask.background_show) {
+
+                if(!begin && (end == VIDEO_WIDTH)) {
+                        nes_video_render_tile(video, scanline);
+                } else {
+                        nes_video_render_background(video, scanline, begin, end);
+                }
+        }
+
+        if(video->mask.sprite_show) {
+                nes_video_render_sprite(video, scanline, begin, end);
+        }
+
+        if(video->frame_buffer) {
+
+                for(uint16_t x = begin; x < end; ++x) {
+                        video->frame_buffer[scanline][x] = nes_video_palette(video, video->line[x]) | video->color;
+                }
+        } else {
+
+                for(uint16_t x = begin; x < end; ++x) {
+                        nes_service_pixel(nes_video_palette(video, video->line[x]) | video->color, x, scanline);
+                }
+        }
+
+        video->span = end;
+}
+
+void
+nes_video_render_sprite(
+        __inout nes_video_t *video,
+        __in uint16_t scanline,
+        __in uint16_t begin,
+        __in uint16_t end
+        )
+{
+        uint8_t count = 0;
+        bool covered[VIDEO_WIDTH] = {};
+
+        for(uint8_t index = 0; index < VIDEO_SPRITE_COUNT; ++index) {
+                uint8_t high, low, row;
+                uint16_t pattern;
+                nes_video_sprite_t sprite = {};
+
+                if(!nes_video_sprite(video, index, scanline, &sprite, &row)) {
+                        continue;
+                }
+
+                if(count++ == VIDEO_SPRITE_MAX) {
+                        video->status.sprite_overflow = true;
+                        break;
+                }
+
+                pattern = nes_video_sprite_pattern(video, &sprite, row);
+                low = nes_video_read(video, pattern);
+                high = nes_video_read(video, pattern + VIDEO_TILE_WIDTH);
+
+                for(uint8_t column = 0; column < VIDEO_TILE_WIDTH; ++column) {
+                        uint8_t bit = sprite.attribute.flip_horizontal ? column : ((VIDEO_TILE_WIDTH - 1) - column), value;
+                        uint16_t x = sprite.x + column;
+
+                        if((x < begin) || (x >= end) || covered[x] || ((x < VIDEO_TILE_WIDTH) && !video->mask.sprite_show_top)
+                                        || !(value = ((low >> bit) & 1) | (((high >> bit) & 1) << 1))) {
+                                continue;
+                        }
+
+                        if(!sprite.attribute.priority || !(video->line[x] % 4)) {
+                                video->line[x] = 0x10 | (sprite.attribute.palette << 2) | value;
+                        }
+
+                        covered[x] = true;
+                }
+        }
+}
+
+void
+nes_video_render_tile(
+        __inout nes_video_t *video,
+        __in uint16_t scanline
+        )
+{
+        uint16_t position_y = (scanline + video->scroll_y.low + ((video->control.name_table / 2) * VIDEO_HEIGHT)) % (VIDEO_HEIGHT * 2);
+        uint16_t tile_y = (position_y % VIDEO_HEIGHT) / VIDEO_TILE_WIDTH;
+
+        if(video->surface) {
+                uint16_t x = video->mask.background_show_top ? 0 : VIDEO_TILE_WIDTH;
+                uint16_t count, position_x = (x + video->scroll_x.low + ((video->control.name_table % 2) * VIDEO_WIDTH)) % (VIDEO_WIDTH * 2);
+
+                nes_video_surface_update(video);
+
+                if((count = (VIDEO_WIDTH * 2) - position_x) > (VIDEO_WIDTH - x)) {
+                        count = VIDEO_WIDTH - x;
+                }
+
+                memcpy(&video->line[x], &video->surface->pixel[position_y][position_x], count);
+                memcpy(&video->line[x + count], video->surface->pixel[position_y], VIDEO_WIDTH - (x + count));
+                return;
+        }
+
+        for(uint16_t x = video->mask.background_show_top ? 0 : VIDEO_TILE_WIDTH; x < VIDEO_WIDTH;) {
+                uint8_t attribute, high, low, tile;
+                uint16_t base, count, fine, pattern, tile_x;
+                uint16_t position_x = (x + video->scroll_x.low + ((video->control.name_table % 2) * VIDEO_WIDTH)) % (VIDEO_WIDTH * 2);
+
+                tile_x = (position_x % VIDEO_WIDTH) / VIDEO_TILE_WIDTH;
+                base = VIDEO_RAM_BEGIN + ((((position_y / VIDEO_HEIGHT) * 2) + (position_x / VIDEO_WIDTH)) * VIDEO_NAME_TABLE_WIDTH);
+                tile = nes_video_read(video, base + (tile_y * (VIDEO_WIDTH / VIDEO_TILE_WIDTH)) + tile_x);
+                pattern = (video->control.background_pattern_table * VIDEO_PATTERN_TABLE_WIDTH) + (tile * VIDEO_TILE_BYTES) + (position_y % VIDEO_TILE_WIDTH);
+                low = nes_video_read(video, pattern);
+                high = nes_video_read(video, pattern + VIDEO_TILE_WIDTH);
+                attribute = nes_video_read(video, base + VIDEO_ATTRIBUTE_OFFSET + ((tile_y / 4) * VIDEO_TILE_WIDTH) + (tile_x / 4));
+                attribute = ((attribute >> (((tile_y & 2) << 1) | (tile_x & 2))) & 3) << 2;
+                fine = position_x % VIDEO_TILE_WIDTH;
+
+                if((count = VIDEO_TILE_WIDTH - fine) > (VIDEO_WIDTH - x)) {
+                        count = VIDEO_WIDTH - x;
+                }
+
+                for(uint16_t column = fine; column < (fine + count); ++column, ++x) {
+                        uint8_t bit = (VIDEO_TILE_WIDTH - 1) - column, value = ((low >> bit) & 1) | (((high >> bit) & 1) << 1);
+
+                        video->line[x] = value ? (value | attribute) : 0;
+                }
+        }
 }
 
 void
@@ -154,35 +575,205 @@ nes_video_reset(
 {
         TRACE(LEVEL_VERBOSE, "%s", "Video reset");
         memset(video, 0, sizeof(*video));
+        video->event = (VIDEO_EVENT_VBLANK + (VIDEO_CYCLES - 1)) / VIDEO_CYCLES;
+        video->predict = true;
         TRACE_VIDEO(LEVEL_VERBOSE, video);
 }
 
 bool
-nes_video_step(
-        __inout nes_video_t *video
+nes_video_sprite(
+        __inout nes_video_t *video,
+        __in uint8_t index,
+        __in uint16_t scanline,
+        __inout nes_video_sprite_t *sprite,
+        __inout uint8_t *row
         )
 {
         bool result = false;
+        uint8_t address = index * sizeof(*sprite), height = video->control.sprite_size ? (VIDEO_TILE_WIDTH * 2) : VIDEO_TILE_WIDTH;
+
+        sprite->y = nes_video_object_read(video, address);
 
-        if(!video->cycles) {
-                video->cycles = VIDEO_CYCLES;
+        if((scanline < (sprite->y + 1)) || ((*row = (scanline - (sprite->y + 1))) >= height)) {
+                goto exit;
+        }
 
-                /* TODO: STEP VIDEO */
+        sprite->tile = nes_video_object_read(video, address + 1);
+        sprite->attribute.raw = nes_video_object_read(video, address + 2);
+        sprite->x = nes_video_object_read(video, address + 3);
 
-                TRACE_VIDEO(LEVEL_VERBOSE, video);
+        if(sprite->attribute.flip_vertical) {
+                *row = (height - 1) - *row;
+        }
+
+        result = true;
+
+exit:
+        return result;
+}
+
+uint16_t
+nes_video_sprite_pattern(
+        __inout nes_video_t *video,
+        __in const nes_video_sprite_t *sprite,
+        __in uint8_t row
+        )
+{
+        uint16_t result;
+
+        if(video->control.sprite_size) {
+                result = ((sprite->tile & 1) * VIDEO_PATTERN_TABLE_WIDTH) + (((sprite->tile & 0xfe) + (row / VIDEO_TILE_WIDTH)) * VIDEO_TILE_BYTES);
+        } else {
+                result = (video->control.sprite_pattern_table * VIDEO_PATTERN_TABLE_WIDTH) + (sprite->tile * VIDEO_TILE_BYTES);
         }
 
-        --video->cycles;
+        return result + (row % VIDEO_TILE_WIDTH);
+}
 
-        /* TODO: DEBUG */
-        if((result = (video->cycles_frame++ >= CYCLES_PER_FRAME))) {
-                video->cycles_frame = 0;
+void
+nes_video_split(
+        __inout nes_video_t *video
+        )
+{
+
+        if((video->scanline >= VIDEO_HEIGHT) || (video->dot <= video->span) || (video->dot >= VIDEO_WIDTH) || video->band || video->skip) {
+                return;
+        }
+
+        if(video->pipeline) {
+                nes_video_pipeline_push(video->pipeline, VIDEO_ENTRY_SPAN, video->scanline, video->dot, video->cycle);
+                video->span = video->dot;
+        } else {
+                nes_video_render_span(video, video->scanline, video->dot);
+        }
+}
+
+bool
+nes_video_step(
+        __inout nes_video_t *video,
+        __in uint64_t cycle
+        )
+{
+        bool result;
+
+        nes_video_synchronize(video, cycle);
+
+        if((result = video->complete)) {
+                video->complete = false;
+
+                if(video->pipeline) {
+                        /* The pipeline displays the previous frame, so report whether that frame was skipped */
+                        video->skip = nes_video_pipeline_present(video->pipeline, video->skip);
+                }
+
+                TRACE_VIDEO(LEVEL_VERBOSE, video);
         }
-        /* --- */
 
         return result;
 }
 
+void
+nes_video_synchronize(
+        __inout nes_video_t *video,
+        __in uint64_t cycle
+        )
+{
+
+        if(cycle > video->cycle) {
+                uint64_t dots;
+                uint32_t position;
+
+                dots = (cycle - video->cycle) * VIDEO_CYCLES;
+                position = (video->scanline * VIDEO_DOTS) + video->dot;
+                video->cycle = cycle;
+
+                if(video->predict) {
+                        nes_video_predict(video, position);
+                }
+
+                while(dots) {
+                        uint32_t event = nes_video_event(position), next = event;
+
+                        if(video->hit && (video->hit < next)) {
+                                next = video->hit;
+                        }
+
+                        if((next - position) > dots) {
+                                position += dots;
+                                break;
+                        }
+
+                        dots -= (next - position);
+                        position = next;
+
+                        if(position == video->hit) {
+                                video->status.sprite_0_hit = true;
+                                video->hit = 0;
+                        }
+
+                        if(position != event) {
+                                continue;
+                        }
+
+                        switch(position) {
+                                case VIDEO_EVENT_VBLANK:
+                                        video->status.vblank = true;
+                                        video->complete = true;
+
+                                        if(video->pipeline) {
+                                                nes_video_pipeline_push(video->pipeline, VIDEO_ENTRY_FRAME, 0, 0, video->cycle);
+                                        } else if(video->band && !video->skip) {
+                                                nes_video_band_render(video->band);
+                                        }
+
+                                        if(video->control.interrupt) {
+                                                nes_bus_interrupt(false);
+                                        }
+                                        break;
+                                case VIDEO_EVENT_PRERENDER:
+                                        video->status.sprite_0_hit = false;
+                                        video->status.sprite_overflow = false;
+                                        video->status.vblank = false;
+                                        break;
+                                case VIDEO_EVENT_FRAME:
+                                        position = 0;
+                                        ++video->frame;
+                                        nes_video_predict(video, position);
+                                        break;
+                                default:
+
+                                        if(!video->mask.background_show && !video->mask.sprite_show) {
+                                                ++video->blank;
+                                        }
+
+                                        if(video->pipeline) {
+                                                nes_video_pipeline_push(video->pipeline, VIDEO_ENTRY_RENDER, position / VIDEO_DOTS, video->skip, video->cycle);
+                                                nes_video_evaluate(video, position / VIDEO_DOTS);
+                                                video->span = 0;
+                                        } else if(video->band) {
+
+                                                if(!video->skip) {
+                                                        nes_video_band_snapshot(video->band, video, position / VIDEO_DOTS);
+                                                }
+
+                                                nes_video_evaluate(video, position / VIDEO_DOTS);
+                                        } else if(video->skip) {
+                                                nes_video_evaluate(video, position / VIDEO_DOTS);
+                                                video->span = 0;
+                                        } else {
+                                                nes_video_render(video, position / VIDEO_DOTS);
+                                        }
+                                        break;
+                        }
+                }
+
+                video->scanline = position / VIDEO_DOTS;
+                video->dot = position % VIDEO_DOTS;
+                video->event = video->cycle + ((((position < VIDEO_EVENT_VBLANK) ? VIDEO_EVENT_VBLANK : (VIDEO_EVENT_FRAME + VIDEO_EVENT_VBLANK)) - position)
+                                                + (VIDEO_CYCLES - 1)) / VIDEO_CYCLES;
+        }
+}
+
 void
 nes_video_write(
         __inout nes_video_t *video,
@@ -191,6 +782,15 @@ nes_video_write(
         )
 {
         nes_bus_write(BUS_VIDEO, address, data);
+        video->predict = true;
+
+        if(video->surface) {
+                nes_video_surface_write(video->surface, address);
+        }
+
+        if(video->pipeline) {
+                nes_video_pipeline_push(video->pipeline, VIDEO_ENTRY_MEMORY, nes_video_mirror(address), nes_bus_read(BUS_VIDEO, address), video->cycle);
+        }
 }
 
 #ifdef __cplusplus
@@ -0,0 +1,200 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./video_type.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+int
+nes_video_band_load(
+        __inout nes_video_t *video,
+        __in unsigned count
+        )
+{
+        int result = NES_OK;
+        nes_video_band_t *band = NULL;
+
+        TRACE(LEVEL_VERBOSE, "%s", "Video band loading");
+
+        if(!count || (count > VIDEO_BAND_MAX)) {
+                result = ERROR(NES_ERR, "invalid video band count -- %u (expecting 1-%u)", count, VIDEO_BAND_MAX);
+                goto exit;
+        }
+
+        if(!(band = calloc(1, sizeof(*band)))) {
+                result = ERROR(NES_ERR, "failed to allocate video band -- %.02f KB (%zu bytes)", sizeof(*band) / (float)BYTES_PER_KBYTE,
+                        sizeof(*band));
+                goto exit;
+        }
+
+        if((mtx_init(&band->lock, mtx_plain) != thrd_success)
+                        || (cnd_init(&band->complete) != thrd_success)
+                        || (cnd_init(&band->start) != thrd_success)) {
+                result = ERROR(NES_ERR, "%s", "failed to initialize video band synchronization");
+                free(band);
+                goto exit;
+        }
+
+        band->running = true;
+        video->band = band;
+
+        for(; band->count < count; ++band->count) {
+                band->context[band->count].band = band;
+                band->context[band->count].index = band->count;
+
+                if(thrd_create(&band->thread[band->count], nes_video_band_run, &band->context[band->count]) != thrd_success) {
+                        result = ERROR(NES_ERR, "failed to create video band thread -- %u", band->count);
+                        nes_video_band_unload(video);
+                        goto exit;
+                }
+        }
+
+        TRACE(LEVEL_VERBOSE, "Video band loaded: %u", band->count);
+
+exit:
+        return result;
+}
+
+void
+nes_video_band_render(
+        __inout nes_video_band_t *band
+        )
+{
+        mtx_lock(&band->lock);
+        band->pending = band->count;
+        ++band->generation;
+        cnd_broadcast(&band->start);
+
+        while(band->pending) {
+                cnd_wait(&band->complete, &band->lock);
+        }
+
+        mtx_unlock(&band->lock);
+
+        for(uint16_t y = 0; y < VIDEO_HEIGHT; ++y) {
+
+                for(uint16_t x = 0; x < VIDEO_WIDTH; ++x) {
+                        nes_service_pixel(band->frame[y][x], x, y);
+                }
+        }
+}
+
+int
+nes_video_band_run(
+        __in void *context
+        )
+{
+        uint64_t generation = 0;
+        nes_video_band_t *band = ((nes_video_band_context_t *)context)->band;
+        unsigned index = ((nes_video_band_context_t *)context)->index;
+
+        for(;;) {
+                uint16_t begin, end;
+                nes_video_t video = {};
+
+                mtx_lock(&band->lock);
+
+                while(band->running && (band->generation == generation)) {
+                        cnd_wait(&band->start, &band->lock);
+                }
+
+                if(!band->running) {
+                        mtx_unlock(&band->lock);
+                        break;
+                }
+
+                generation = band->generation;
+                begin = (index * VIDEO_HEIGHT) / band->count;
+                end = ((index + 1) * VIDEO_HEIGHT) / band->count;
+                mtx_unlock(&band->lock);
+                video.frame_buffer = band->frame;
+
+                for(uint16_t scanline = begin; scanline < end; ++scanline) {
+                        const nes_video_snapshot_t *snapshot = &band->snapshot[scanline];
+
+                        video.control.raw = snapshot->control.raw;
+                        nes_video_mask(&video, snapshot->mask.raw);
+                        video.scroll_x.word = snapshot->scroll_x.word;
+                        video.scroll_y.word = snapshot->scroll_y.word;
+                        nes_video_render(&video, scanline);
+                }
+
+                mtx_lock(&band->lock);
+
+                if(!--band->pending) {
+                        cnd_signal(&band->complete);
+                }
+
+                mtx_unlock(&band->lock);
+        }
+
+        return NES_OK;
+}
+
+void
+nes_video_band_snapshot(
+        __inout nes_video_band_t *band,
+        __in const nes_video_t *video,
+        __in uint16_t scanline
+        )
+{
+        nes_video_snapshot_t *snapshot = &band->snapshot[scanline];
+
+        snapshot->control.raw = video->control.raw;
+        snapshot->mask.raw = video->mask.raw;
+        snapshot->scroll_x.word = video->scroll_x.word;
+        snapshot->scroll_y.word = video->scroll_y.word;
+}
+
+void
+nes_video_band_unload(
+        __inout nes_video_t *video
+        )
+{
+        nes_video_band_t *band = video->band;
+
+        if(!band) {
+                return;
+        }
+
+        TRACE(LEVEL_VERBOSE, "%s", "Video band unloading");
+        mtx_lock(&band->lock);
+        band->running = false;
+        cnd_broadcast(&band->start);
+        mtx_unlock(&band->lock);
+
+        for(unsigned index = 0; index < band->count; ++index) {
+                thrd_join(band->thread[index], NULL);
+        }
+
+        cnd_destroy(&band->start);
+        cnd_destroy(&band->complete);
+        mtx_destroy(&band->lock);
+        free(band);
+        video->band = NULL;
+        TRACE(LEVEL_VERBOSE, "%s", "Video band unloaded");
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,289 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./video_type.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void
+nes_video_pipeline_acquire(
+        __inout nes_video_pipeline_t *pipeline
+        )
+{
+        uint64_t frame = atomic_load(&pipeline->frame_rendered);
+
+        mtx_lock(&pipeline->lock);
+
+        while(((frame - atomic_load(&pipeline->frame_consumed)) >= VIDEO_PIPELINE_FRAME_MAX) && atomic_load(&pipeline->running)) {
+                cnd_wait(&pipeline->available, &pipeline->lock);
+        }
+
+        mtx_unlock(&pipeline->lock);
+
+        pipeline->video.frame_buffer = pipeline->frame[frame % VIDEO_PIPELINE_FRAME_MAX];
+}
+
+int
+nes_video_pipeline_load(
+        __inout nes_video_t *video
+        )
+{
+        int result = NES_OK;
+        nes_video_pipeline_t *pipeline = NULL;
+
+        TRACE(LEVEL_VERBOSE, "%s", "Video pipeline loading");
+
+        if(!(pipeline = calloc(1, sizeof(*pipeline)))) {
+                result = ERROR(NES_ERR, "failed to allocate video pipeline -- %.02f KB (%zu bytes)", sizeof(*pipeline) / (float)BYTES_PER_KBYTE,
+                        sizeof(*pipeline));
+                goto exit;
+        }
+
+        if((mtx_init(&pipeline->lock, mtx_plain) != thrd_success)
+                        || (cnd_init(&pipeline->available) != thrd_success)
+                        || (cnd_init(&pipeline->rendered) != thrd_success)) {
+                result = ERROR(NES_ERR, "%s", "failed to initialize video pipeline synchronization");
+                free(pipeline);
+                goto exit;
+        }
+
+        for(uint32_t address = 0; address < VIDEO_ADDRESS_MIRROR; ++address) {
+                pipeline->shadow.memory[address] = nes_bus_read(BUS_VIDEO, address);
+        }
+
+        for(uint32_t address = 0; address < VIDEO_OBJECT_WIDTH; ++address) {
+                pipeline->shadow.object[address] = nes_bus_read(BUS_OBJECT, address);
+        }
+
+        pipeline->video = *video;
+        pipeline->video.frame_buffer = pipeline->frame[0];
+        pipeline->video.pipeline = NULL;
+        pipeline->video.shadow = &pipeline->shadow;
+        pipeline->video.surface = NULL;
+        atomic_store(&pipeline->running, true);
+
+        if(thrd_create(&pipeline->thread, nes_video_pipeline_run, pipeline) != thrd_success) {
+                result = ERROR(NES_ERR, "%s", "failed to create video pipeline thread");
+                cnd_destroy(&pipeline->rendered);
+                cnd_destroy(&pipeline->available);
+                mtx_destroy(&pipeline->lock);
+                free(pipeline);
+                goto exit;
+        }
+
+        video->pipeline = pipeline;
+        TRACE(LEVEL_VERBOSE, "%s", "Video pipeline loaded");
+
+exit:
+        return result;
+}
+
+bool
+nes_video_pipeline_present(
+        __inout nes_video_pipeline_t *pipeline,
+        __in bool skip
+        )
+{
+        pipeline->skip[pipeline->frame_pushed % VIDEO_PIPELINE_FRAME_MAX] = skip;
+
+        if(++pipeline->frame_pushed < VIDEO_PIPELINE_FRAME_MAX) {
+                return skip;
+        }
+
+        skip = pipeline->skip[(pipeline->frame_pushed - 2) % VIDEO_PIPELINE_FRAME_MAX];
+
+        mtx_lock(&pipeline->lock);
+
+        while(atomic_load(&pipeline->frame_rendered) < (pipeline->frame_pushed - 1)) {
+                cnd_wait(&pipeline->rendered, &pipeline->lock);
+        }
+
+        mtx_unlock(&pipeline->lock);
+
+        for(uint16_t y = 0; !skip && (y < VIDEO_HEIGHT); ++y) {
+
+                for(uint16_t x = 0; x < VIDEO_WIDTH; ++x) {
+                        nes_service_pixel(pipeline->frame[(pipeline->frame_pushed - 2) % VIDEO_PIPELINE_FRAME_MAX][y][x], x, y);
+                }
+        }
+
+        mtx_lock(&pipeline->lock);
+        atomic_store(&pipeline->frame_consumed, pipeline->frame_pushed - 1);
+        cnd_signal(&pipeline->available);
+        mtx_unlock(&pipeline->lock);
+
+        return skip;
+}
+
+void
+nes_video_pipeline_push(
+        __inout nes_video_pipeline_t *pipeline,
+        __in int type,
+        __in uint16_t address,
+        __in uint8_t data,
+        __in uint64_t cycle
+        )
+{
+        nes_video_entry_t *entry;
+        unsigned write = atomic_load_explicit(&pipeline->write, memory_order_relaxed);
+
+        if((write - atomic_load_explicit(&pipeline->read, memory_order_acquire)) >= VIDEO_PIPELINE_ENTRY_MAX) {
+                mtx_lock(&pipeline->lock);
+                atomic_store(&pipeline->waiting, true);
+
+                while((write - atomic_load(&pipeline->read)) >= VIDEO_PIPELINE_ENTRY_MAX) {
+                        cnd_wait(&pipeline->rendered, &pipeline->lock);
+                }
+
+                atomic_store(&pipeline->waiting, false);
+                mtx_unlock(&pipeline->lock);
+        }
+
+        entry = &pipeline->entry[write % VIDEO_PIPELINE_ENTRY_MAX];
+        entry->cycle = cycle;
+        entry->address = address;
+        entry->data = data;
+        entry->type = type;
+        atomic_store_explicit(&pipeline->write, write + 1, memory_order_release);
+
+        if((type == VIDEO_ENTRY_FRAME) || (type == VIDEO_ENTRY_EXIT)) {
+                mtx_lock(&pipeline->lock);
+                cnd_signal(&pipeline->available);
+                mtx_unlock(&pipeline->lock);
+        }
+}
+
+int
+nes_video_pipeline_run(
+        __in void *context
+        )
+{
+        nes_video_pipeline_t *pipeline = context;
+        nes_video_t *video = &pipeline->video;
+
+        for(;;) {
+                nes_video_entry_t *entry;
+                unsigned read = atomic_load_explicit(&pipeline->read, memory_order_relaxed);
+
+                if(read == atomic_load_explicit(&pipeline->write, memory_order_acquire)) {
+                        mtx_lock(&pipeline->lock);
+
+                        while(read == atomic_load_explicit(&pipeline->write, memory_order_acquire)) {
+                                cnd_wait(&pipeline->available, &pipeline->lock);
+                        }
+
+                        mtx_unlock(&pipeline->lock);
+                }
+
+                entry = &pipeline->entry[read % VIDEO_PIPELINE_ENTRY_MAX];
+                video->cycle = entry->cycle;
+
+                switch(entry->type) {
+                        case VIDEO_ENTRY_CONTROL:
+                                video->control.raw = entry->data;
+                                break;
+                        case VIDEO_ENTRY_MASK:
+                                nes_video_mask(video, entry->data);
+                                break;
+                        case VIDEO_ENTRY_SCROLL_X:
+                                video->scroll_x.low = entry->data;
+                                break;
+                        case VIDEO_ENTRY_SCROLL_Y:
+                                video->scroll_y.low = entry->data;
+                                break;
+                        case VIDEO_ENTRY_MEMORY:
+                                pipeline->shadow.memory[entry->address] = entry->data;
+                                break;
+                        case VIDEO_ENTRY_OBJECT:
+                                pipeline->shadow.object[entry->address] = entry->data;
+                                break;
+                        case VIDEO_ENTRY_RENDER:
+
+                                if(entry->data) {
+                                        video->span = 0;
+                                        break;
+                                }
+
+                                if(!entry->address && !video->span) {
+                                        nes_video_pipeline_acquire(pipeline);
+                                }
+
+                                nes_video_render(video, entry->address);
+                                break;
+                        case VIDEO_ENTRY_SPAN:
+
+                                if(!entry->address && !video->span) {
+                                        nes_video_pipeline_acquire(pipeline);
+                                }
+
+                                nes_video_render_span(video, entry->address, entry->data);
+                                break;
+                        case VIDEO_ENTRY_FRAME:
+                                mtx_lock(&pipeline->lock);
+                                atomic_fetch_add(&pipeline->frame_rendered, 1);
+                                cnd_signal(&pipeline->rendered);
+                                mtx_unlock(&pipeline->lock);
+                                break;
+                        case VIDEO_ENTRY_EXIT:
+                                atomic_store_explicit(&pipeline->read, read + 1, memory_order_release);
+                                return NES_OK;
+                        default:
+                                break;
+                }
+
+                atomic_store(&pipeline->read, read + 1);
+
+                if(atomic_load(&pipeline->waiting)) {
+                        mtx_lock(&pipeline->lock);
+                        cnd_signal(&pipeline->rendered);
+                        mtx_unlock(&pipeline->lock);
+                }
+        }
+}
+
+void
+nes_video_pipeline_unload(
+        __inout nes_video_t *video
+        )
+{
+        nes_video_pipeline_t *pipeline = video->pipeline;
+
+        if(!pipeline) {
+                return;
+        }
+
+        TRACE(LEVEL_VERBOSE, "%s", "Video pipeline unloading");
+        atomic_store(&pipeline->running, false);
+        nes_video_pipeline_push(pipeline, VIDEO_ENTRY_EXIT, 0, 0, video->cycle);
+        thrd_join(pipeline->thread, NULL);
+        cnd_destroy(&pipeline->rendered);
+        cnd_destroy(&pipeline->available);
+        mtx_destroy(&pipeline->lock);
+        free(pipeline);
+        video->pipeline = NULL;
+        TRACE(LEVEL_VERBOSE, "%s", "Video pipeline unloaded");
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
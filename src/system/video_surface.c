@@ -0,0 +1,192 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./video_type.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void
+nes_video_surface_invalidate(
+        __inout nes_video_surface_t *surface
+        )
+{
+        memset(surface->dirty_tile, true, sizeof(surface->dirty_tile));
+        surface->dirty = true;
+}
+
+int
+nes_video_surface_load(
+        __inout nes_video_t *video
+        )
+{
+        int result = NES_OK;
+        nes_video_surface_t *surface = NULL;
+
+        TRACE(LEVEL_VERBOSE, "%s", "Video surface loading");
+
+        if(!(surface = calloc(1, sizeof(*surface)))) {
+                result = ERROR(NES_ERR, "failed to allocate video surface -- %.02f KB (%zu bytes)", sizeof(*surface) / (float)BYTES_PER_KBYTE,
+                        sizeof(*surface));
+                goto exit;
+        }
+
+        surface->pattern_table = video->control.background_pattern_table;
+        nes_video_surface_invalidate(surface);
+        video->surface = surface;
+        TRACE(LEVEL_VERBOSE, "%s", "Video surface loaded");
+
+exit:
+        return result;
+}
+
+void
+nes_video_surface_render(
+        __inout nes_video_t *video,
+        __in uint16_t tile_x,
+        __in uint16_t tile_y,
+        __in uint8_t tile
+        )
+{
+        uint8_t attribute;
+        uint16_t base, column = tile_x % VIDEO_SURFACE_TILE_WIDTH, pattern, row = tile_y % VIDEO_SURFACE_TILE_HEIGHT;
+        nes_video_surface_t *surface = video->surface;
+
+        base = VIDEO_RAM_BEGIN + ((((tile_y / VIDEO_SURFACE_TILE_HEIGHT) * 2) + (tile_x / VIDEO_SURFACE_TILE_WIDTH)) * VIDEO_NAME_TABLE_WIDTH);
+        attribute = nes_video_read(video, base + VIDEO_ATTRIBUTE_OFFSET + ((row / 4) * VIDEO_TILE_WIDTH) + (column / 4));
+        attribute = ((attribute >> (((row & 2) << 1) | (column & 2))) & 3) << 2;
+        pattern = (surface->pattern_table * VIDEO_PATTERN_TABLE_WIDTH) + (tile * VIDEO_TILE_BYTES);
+
+        for(uint16_t y = 0; y < VIDEO_TILE_WIDTH; ++y) {
+                uint8_t high = nes_video_read(video, pattern + y + VIDEO_TILE_WIDTH), low = nes_video_read(video, pattern + y);
+                uint8_t *pixel = &surface->pixel[(tile_y * VIDEO_TILE_WIDTH) + y][tile_x * VIDEO_TILE_WIDTH];
+
+                for(uint16_t x = 0; x < VIDEO_TILE_WIDTH; ++x) {
+                        uint8_t bit = (VIDEO_TILE_WIDTH - 1) - x, value = ((low >> bit) & 1) | (((high >> bit) & 1) << 1);
+
+                        pixel[x] = value ? (value | attribute) : 0;
+                }
+        }
+}
+
+void
+nes_video_surface_unload(
+        __inout nes_video_t *video
+        )
+{
+
+        if(!video->surface) {
+                return;
+        }
+
+        TRACE(LEVEL_VERBOSE, "%s", "Video surface unloading");
+        free(video->surface);
+        video->surface = NULL;
+        TRACE(LEVEL_VERBOSE, "%s", "Video surface unloaded");
+}
+
+void
+nes_video_surface_update(
+        __inout nes_video_t *video
+        )
+{
+        nes_video_surface_t *surface = video->surface;
+
+        if(surface->pattern_table != video->control.background_pattern_table) {
+                surface->pattern_table = video->control.background_pattern_table;
+                nes_video_surface_invalidate(surface);
+        }
+
+        if(!surface->dirty) {
+                return;
+        }
+
+        for(uint16_t tile_y = 0; tile_y < (VIDEO_SURFACE_TILE_HEIGHT * 2); ++tile_y) {
+
+                for(uint16_t tile_x = 0; tile_x < (VIDEO_SURFACE_TILE_WIDTH * 2); ++tile_x) {
+                        uint8_t tile = nes_video_read(video, VIDEO_RAM_BEGIN
+                                + ((((tile_y / VIDEO_SURFACE_TILE_HEIGHT) * 2) + (tile_x / VIDEO_SURFACE_TILE_WIDTH)) * VIDEO_NAME_TABLE_WIDTH)
+                                + ((tile_y % VIDEO_SURFACE_TILE_HEIGHT) * VIDEO_SURFACE_TILE_WIDTH) + (tile_x % VIDEO_SURFACE_TILE_WIDTH));
+
+                        if(surface->dirty_tile[tile_y][tile_x] || surface->dirty_pattern[(surface->pattern_table * VIDEO_SURFACE_PATTERN_TILES) + tile]) {
+                                nes_video_surface_render(video, tile_x, tile_y, tile);
+                                surface->dirty_tile[tile_y][tile_x] = false;
+                        }
+                }
+        }
+
+        memset(surface->dirty_pattern, false, sizeof(surface->dirty_pattern));
+        surface->dirty = false;
+}
+
+void
+nes_video_surface_write(
+        __inout nes_video_surface_t *surface,
+        __in uint16_t address
+        )
+{
+        uint16_t offset;
+
+        switch((address = nes_video_mirror(address))) {
+                case VIDEO_ROM_BEGIN ... VIDEO_ROM_END: /* 0x0000 - 0x1fff */
+                        surface->dirty_pattern[address / VIDEO_TILE_BYTES] = true;
+                        surface->dirty = true;
+                        break;
+                case VIDEO_RAM_BEGIN ... VIDEO_RAM_END: /* 0x2000 - 0x3eff */
+
+                        if((offset = (address - VIDEO_RAM_BEGIN) % VIDEO_NAME_TABLE_WIDTH) < VIDEO_ATTRIBUTE_OFFSET) {
+                                nes_video_surface_write_tile(surface, offset % VIDEO_SURFACE_TILE_WIDTH, offset / VIDEO_SURFACE_TILE_WIDTH);
+                        } else {
+                                offset -= VIDEO_ATTRIBUTE_OFFSET;
+
+                                for(uint16_t tile_y = (offset / VIDEO_TILE_WIDTH) * 4; (tile_y < (((offset / VIDEO_TILE_WIDTH) + 1) * 4))
+                                                && (tile_y < VIDEO_SURFACE_TILE_HEIGHT); ++tile_y) {
+
+                                        for(uint16_t tile_x = (offset % VIDEO_TILE_WIDTH) * 4; tile_x < (((offset % VIDEO_TILE_WIDTH) + 1) * 4); ++tile_x) {
+                                                nes_video_surface_write_tile(surface, tile_x, tile_y);
+                                        }
+                                }
+                        }
+                        break;
+                default: /* 0x3f00 - 0x3fff */
+                        break;
+        }
+}
+
+void
+nes_video_surface_write_tile(
+        __inout nes_video_surface_t *surface,
+        __in uint16_t tile_x,
+        __in uint16_t tile_y
+        )
+{
+
+        for(uint8_t name_table = 0; name_table < VIDEO_NAME_TABLE_MAX; ++name_table) {
+                surface->dirty_tile[((name_table / 2) * VIDEO_SURFACE_TILE_HEIGHT) + tile_y][((name_table % 2) * VIDEO_SURFACE_TILE_WIDTH) + tile_x] = true;
+        }
+
+        surface->dirty = true;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
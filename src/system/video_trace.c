@@ -57,7 +57,7 @@ nes_video_trace(
 {
 
         if(level <= LEVEL) {
-                TRACE(level, "Video cycles: %u", video->cycles);
+                TRACE(level, "Video cycle: %lu (Frame %lu, Scanline %u, Dot %u)", video->cycle, video->frame, video->scanline, video->dot);
                 TRACE(level, "Video CTRL: %02X [%s, %s, %s, %s, %s, %s]", video->control.raw, NAME_TABLE_FORMAT[video->control.name_table],
                         INCREMENT_FORMAT[video->control.increment], PATTERN_TABLE_FORMAT[video->control.sprite_pattern_table],
                         PATTERN_TABLE_FORMAT[video->control.background_pattern_table], SPRITE_SIZE_FORMAT[video->control.sprite_size],
@@ -73,6 +73,7 @@ nes_video_trace(
                 TRACE(level, "Video OBJ-DATA: %02X", video->object_data.low);
                 TRACE(level, "Video SCR-X: %02X, %02X", video->scroll_x);
                 TRACE(level, "Video SCR-Y: %02X, %02X", video->scroll_y);
+                TRACE(level, "Video BLANK: %lu", video->blank);
         }
 }
 
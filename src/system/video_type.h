@@ -22,10 +22,127 @@
 #ifndef NES_VIDEO_TYPE_H_
 #define NES_VIDEO_TYPE_H_
 
+#include <stdatomic.h>
+#include <threads.h>
 #include "../../include/system/video.h"
+#include "../../include/service.h"
+
+#define VIDEO_ATTRIBUTE_OFFSET 0x03c0
+
+#define VIDEO_BAND_MAX 8
 
 #define VIDEO_CYCLES 3
 
+#define VIDEO_DOTS 341
+
+#define VIDEO_EVENT_FRAME (VIDEO_SCANLINES * VIDEO_DOTS)
+#define VIDEO_EVENT_PRERENDER ((VIDEO_SCANLINE_PRERENDER * VIDEO_DOTS) + 1)
+#define VIDEO_EVENT_RENDER (VIDEO_HEIGHT * VIDEO_DOTS)
+#define VIDEO_EVENT_VBLANK ((VIDEO_SCANLINE_VBLANK * VIDEO_DOTS) + 1)
+
+#define VIDEO_NAME_TABLE_WIDTH 0x0400
+
+#define VIDEO_OBJECT_WIDTH 0x0100
+
+#define VIDEO_PALETTE_MASK 0x3f
+
+#define VIDEO_PATTERN_TABLE_WIDTH 0x1000
+
+#define VIDEO_PIPELINE_ENTRY_MAX 0x10000
+#define VIDEO_PIPELINE_FRAME_MAX 2
+
+#define VIDEO_SCANLINES 262
+#define VIDEO_SCANLINE_PRERENDER 261
+#define VIDEO_SCANLINE_VBLANK 241
+
+#define VIDEO_SURFACE_PATTERN_TILES 0x0100
+#define VIDEO_SURFACE_TILE_HEIGHT 30
+#define VIDEO_SURFACE_TILE_WIDTH 32
+
+#define VIDEO_SPRITE_COUNT 64
+#define VIDEO_SPRITE_MAX 8
+
+#define VIDEO_TILE_BYTES 16
+#define VIDEO_TILE_WIDTH 8
+
+enum {
+        VIDEO_ENTRY_CONTROL = 0,
+        VIDEO_ENTRY_MASK,
+        VIDEO_ENTRY_SCROLL_X,
+        VIDEO_ENTRY_SCROLL_Y,
+        VIDEO_ENTRY_MEMORY,
+        VIDEO_ENTRY_OBJECT,
+        VIDEO_ENTRY_RENDER,
+        VIDEO_ENTRY_SPAN,
+        VIDEO_ENTRY_FRAME,
+        VIDEO_ENTRY_EXIT,
+};
+
+typedef struct {
+        nes_video_control_t control;
+        nes_video_mask_t mask;
+        nes_register_t scroll_x;
+        nes_register_t scroll_y;
+} nes_video_snapshot_t;
+
+typedef struct {
+        struct nes_video_band_s *band;
+        unsigned index;
+} nes_video_band_context_t;
+
+typedef struct nes_video_band_s {
+        cnd_t complete;
+        nes_video_band_context_t context[VIDEO_BAND_MAX];
+        unsigned count;
+        uint16_t frame[VIDEO_HEIGHT][VIDEO_WIDTH];
+        uint64_t generation;
+        mtx_t lock;
+        unsigned pending;
+        bool running;
+        nes_video_snapshot_t snapshot[VIDEO_HEIGHT];
+        cnd_t start;
+        thrd_t thread[VIDEO_BAND_MAX];
+} nes_video_band_t;
+
+typedef struct {
+        uint64_t cycle;
+        uint16_t address;
+        uint8_t data;
+        uint8_t type;
+} nes_video_entry_t;
+
+typedef struct nes_video_shadow_s {
+        uint8_t memory[VIDEO_ADDRESS_MIRROR];
+        uint8_t object[VIDEO_OBJECT_WIDTH];
+} nes_video_shadow_t;
+
+typedef struct nes_video_pipeline_s {
+        cnd_t available;
+        nes_video_entry_t entry[VIDEO_PIPELINE_ENTRY_MAX];
+        uint16_t frame[VIDEO_PIPELINE_FRAME_MAX][VIDEO_HEIGHT][VIDEO_WIDTH];
+        atomic_uint_fast64_t frame_consumed;
+        uint64_t frame_pushed;
+        atomic_uint_fast64_t frame_rendered;
+        mtx_t lock;
+        atomic_uint read;
+        cnd_t rendered;
+        atomic_bool running;
+        nes_video_shadow_t shadow;
+        bool skip[VIDEO_PIPELINE_FRAME_MAX];
+        thrd_t thread;
+        nes_video_t video;
+        atomic_bool waiting;
+        atomic_uint write;
+} nes_video_pipeline_t;
+
+typedef struct nes_video_surface_s {
+        bool dirty;
+        bool dirty_pattern[VIDEO_SURFACE_PATTERN_TILES * VIDEO_PATTERN_TABLE_MAX];
+        bool dirty_tile[VIDEO_SURFACE_TILE_HEIGHT * 2][VIDEO_SURFACE_TILE_WIDTH * 2];
+        uint8_t pattern_table;
+        uint8_t pixel[VIDEO_HEIGHT * 2][VIDEO_WIDTH * 2];
+} nes_video_surface_t;
+
 static const uint16_t VIDEO_INCREMENT[] = {
         1, /* VIDEO_INCREMENT_ACROSS */
         32, /* VIDEO_INCREMENT_DOWN */
@@ -35,20 +152,167 @@ static const uint16_t VIDEO_INCREMENT[] = {
 extern "C" {
 #endif /* __cplusplus */
 
+uint8_t nes_video_background(
+        __inout nes_video_t *video,
+        __in uint16_t x,
+        __in uint16_t scanline
+        );
+
+void nes_video_band_render(
+        __inout nes_video_band_t *band
+        );
+
+int nes_video_band_run(
+        __in void *context
+        );
+
+void nes_video_band_snapshot(
+        __inout nes_video_band_t *band,
+        __in const nes_video_t *video,
+        __in uint16_t scanline
+        );
+
+void nes_video_evaluate(
+        __inout nes_video_t *video,
+        __in uint16_t scanline
+        );
+
+uint32_t nes_video_event(
+        __in uint32_t position
+        );
+
+uint16_t nes_video_mirror(
+        __in uint16_t address
+        );
+
 uint8_t nes_video_object_read(
-        __inout nes_video_t *video
+        __inout nes_video_t *video,
+        __in uint8_t address
         );
 
 void nes_video_object_write(
         __inout nes_video_t *video,
+        __in uint8_t address,
         __in uint8_t data
         );
 
+uint8_t nes_video_palette(
+        __inout nes_video_t *video,
+        __in uint8_t index
+        );
+
+void nes_video_pipeline_acquire(
+        __inout nes_video_pipeline_t *pipeline
+        );
+
+bool nes_video_pipeline_present(
+        __inout nes_video_pipeline_t *pipeline,
+        __in bool skip
+        );
+
+void nes_video_pipeline_push(
+        __inout nes_video_pipeline_t *pipeline,
+        __in int type,
+        __in uint16_t address,
+        __in uint8_t data,
+        __in uint64_t cycle
+        );
+
+int nes_video_pipeline_run(
+        __in void *context
+        );
+
+void nes_video_predict(
+        __inout nes_video_t *video,
+        __in uint32_t position
+        );
+
 uint8_t nes_video_read(
         __inout nes_video_t *video,
         __in uint16_t address
         );
 
+void nes_video_render(
+        __inout nes_video_t *video,
+        __in uint16_t scanline
+        );
+
+void nes_video_render_background(
+        __inout nes_video_t *video,
+        __in uint16_t scanline,
+        __in uint16_t begin,
+        __in uint16_t end
+        );
+
+void nes_video_render_blank(
+        __inout nes_video_t *video,
+        __in uint16_t scanline,
+        __in uint16_t begin,
+        __in uint16_t end
+        );
+
+void nes_video_render_span(
+        __inout nes_video_t *video,
+        __in uint16_t scanline,
+        __in uint16_t end
+        );
+
+void nes_video_render_sprite(
+        __inout nes_video_t *video,
+        __in uint16_t scanline,
+        __in uint16_t begin,
+        __in uint16_t end
+        );
+
+void nes_video_render_tile(
+        __inout nes_video_t *video,
+        __in uint16_t scanline
+        );
+
+void nes_video_split(
+        __inout nes_video_t *video
+        );
+
+bool nes_video_sprite(
+        __inout nes_video_t *video,
+        __in uint8_t index,
+        __in uint16_t scanline,
+        __inout nes_video_sprite_t *sprite,
+        __inout uint8_t *row
+        );
+
+uint16_t nes_video_sprite_pattern(
+        __inout nes_video_t *video,
+        __in const nes_video_sprite_t *sprite,
+        __in uint8_t row
+        );
+
+void nes_video_surface_invalidate(
+        __inout nes_video_surface_t *surface
+        );
+
+void nes_video_surface_render(
+        __inout nes_video_t *video,
+        __in uint16_t tile_x,
+        __in uint16_t tile_y,
+        __in uint8_t tile
+        );
+
+void nes_video_surface_update(
+        __inout nes_video_t *video
+        );
+
+void nes_video_surface_write(
+        __inout nes_video_surface_t *surface,
+        __in uint16_t address
+        );
+
+void nes_video_surface_write_tile(
+        __inout nes_video_surface_t *surface,
+        __in uint16_t tile_x,
+        __in uint16_t tile_y
+        );
+
 void nes_video_write(
         __inout nes_video_t *video,
         __in uint16_t address,
@@ -27,6 +27,24 @@ static nes_test_action_t g_test = {};
 extern "C" {
 #endif /* __cplusplus */
 
+void
+nes_audio_flush(
+        __inout nes_audio_t *audio,
+        __in uint64_t cycle
+        )
+{
+	return;
+}
+
+void
+nes_audio_synchronize(
+        __inout nes_audio_t *audio,
+        __in uint64_t cycle
+        )
+{
+	return;
+}
+
 nes_bus_t *
 nes_bus(void)
 {
@@ -53,6 +71,34 @@ nes_bus_read(
 	return result;
 }
 
+void
+nes_bus_restore(
+	__in const nes_bus_state_t *state
+	)
+{
+	return;
+}
+
+int
+nes_bus_rewind_pop(void)
+{
+	return NES_EVT;
+}
+
+void
+nes_bus_rewind_push(void)
+{
+	return;
+}
+
+void
+nes_bus_save(
+	__inout nes_bus_state_t *state
+	)
+{
+	return;
+}
+
 void
 nes_bus_write(
 	__in int bus,
@@ -71,6 +117,15 @@ nes_bus_write(
 	}
 }
 
+int
+nes_movie_frame(
+	__inout nes_movie_t *movie,
+	__inout uint8_t *state
+	)
+{
+	return NES_OK;
+}
+
 void
 nes_processor_step(
         __inout nes_processor_t *processor
@@ -80,20 +135,36 @@ nes_processor_step(
 }
 
 int
-nes_service_poll(void)
+nes_service_poll(
+	__inout uint8_t *state,
+	__inout unsigned *speed,
+	__inout bool *rewind
+	)
 {
 	return NES_OK;
 }
 
 int
-nes_service_show(void)
+nes_service_show(
+	__in bool skip
+	)
 {
 	return NES_OK;
 }
 
+void
+nes_video_mask(
+        __inout nes_video_t *video,
+        __in uint8_t data
+        )
+{
+	video->mask.raw = data;
+}
+
 bool
 nes_video_step(
-        __inout nes_video_t *video
+        __inout nes_video_t *video,
+        __in uint64_t cycle
         )
 {
 	return true;
@@ -193,6 +264,86 @@ exit:
 	return result;
 }
 
+int
+nes_test_action_input_read(void)
+{
+	int result = NES_OK;
+
+	for(uint8_t controller = 0; controller < NES_CONTROLLER_MAX; ++controller) {
+		nes_test_initialize();
+		g_test.bus.input.state[controller] = rand();
+		g_test.request.type = NES_ACTION_INPUT_READ;
+		g_test.request.address.word = controller;
+		nes_bus()->loaded = false;
+
+		if(ASSERT(nes_action(&g_test.request, &g_test.response) != NES_OK)) {
+			result = NES_ERR;
+			goto exit;
+		}
+
+		nes_bus()->loaded = true;
+
+		if(ASSERT((nes_action(&g_test.request, &g_test.response) == NES_OK)
+				&& (g_test.response.type == NES_ACTION_INPUT_READ)
+				&& (g_test.response.address.word == controller)
+				&& (g_test.response.data.dword == g_test.bus.input.state[controller]))) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+	g_test.request.address.word = NES_CONTROLLER_MAX;
+
+	if(ASSERT(nes_action(&g_test.request, &g_test.response) != NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_action_input_write(void)
+{
+	int result = NES_OK;
+
+	for(uint8_t controller = 0; controller < NES_CONTROLLER_MAX; ++controller) {
+		nes_test_initialize();
+		g_test.request.type = NES_ACTION_INPUT_WRITE;
+		g_test.request.address.word = controller;
+		g_test.request.data.low = rand();
+		nes_bus()->loaded = false;
+
+		if(ASSERT(nes_action(&g_test.request, &g_test.response) != NES_OK)) {
+			result = NES_ERR;
+			goto exit;
+		}
+
+		nes_bus()->loaded = true;
+
+		if(ASSERT((nes_action(&g_test.request, NULL) == NES_OK)
+				&& (g_test.bus.input.state[controller] == g_test.request.data.low))) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+	g_test.request.address.word = NES_CONTROLLER_MAX;
+
+	if(ASSERT(nes_action(&g_test.request, NULL) != NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
 int
 nes_test_action_mapper_read(void)
 {
@@ -717,6 +868,74 @@ exit:
 	return result;
 }
 
+int
+nes_test_action_speed_read(void)
+{
+	int result = NES_OK;
+
+	nes_test_initialize();
+	g_test.bus.speed = rand();
+	g_test.request.type = NES_ACTION_SPEED_READ;
+	nes_bus()->loaded = false;
+
+	if(ASSERT(nes_action(&g_test.request, &g_test.response) != NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_bus()->loaded = true;
+
+	if(ASSERT((nes_action(&g_test.request, NULL) != NES_OK)
+			&& (nes_action(&g_test.request, &g_test.response) == NES_OK)
+			&& (g_test.response.type == NES_ACTION_SPEED_READ)
+			&& (g_test.response.data.dword == g_test.bus.speed))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_action_speed_write(void)
+{
+	int result = NES_OK;
+
+	nes_test_initialize();
+	g_test.request.type = NES_ACTION_SPEED_WRITE;
+	g_test.request.data.dword = rand();
+	nes_bus()->loaded = false;
+
+	if(ASSERT(nes_action(&g_test.request, &g_test.response) != NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_bus()->loaded = true;
+
+	if(ASSERT((nes_action(&g_test.request, NULL) == NES_OK)
+			&& (g_test.bus.speed == g_test.request.data.dword))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	g_test.request.data.dword = 0;
+
+	if(ASSERT((nes_action(&g_test.request, NULL) == NES_OK)
+			&& !g_test.bus.speed)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
 int
 nes_test_action_video_read(void)
 {
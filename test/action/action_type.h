@@ -43,6 +43,10 @@ int nes_test_action_bus_write(void);
 
 int nes_test_action_cartridge_header(void);
 
+int nes_test_action_input_read(void);
+
+int nes_test_action_input_write(void);
+
 int nes_test_action_mapper_read(void);
 
 int nes_test_action_mapper_write(void);
@@ -51,6 +55,10 @@ int nes_test_action_processor_read(void);
 
 int nes_test_action_processor_write(void);
 
+int nes_test_action_speed_read(void);
+
+int nes_test_action_speed_write(void);
+
 int nes_test_action_video_read(void);
 
 int nes_test_action_video_write(void);
@@ -61,10 +69,14 @@ static const nes_test TEST[] = {
         nes_test_action_bus_read,
         nes_test_action_bus_write,
         nes_test_action_cartridge_header,
+        nes_test_action_input_read,
+        nes_test_action_input_write,
         nes_test_action_mapper_read,
         nes_test_action_mapper_write,
         nes_test_action_processor_read,
         nes_test_action_processor_write,
+        nes_test_action_speed_read,
+        nes_test_action_speed_write,
         nes_test_action_video_read,
         nes_test_action_video_write,
 	};
@@ -0,0 +1,710 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./audio_type.h"
+
+static nes_test_audio_t g_test = {};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void
+nes_bus_interrupt(
+	__in bool maskable
+	)
+{
+
+	if(maskable) {
+		++g_test.interrupt;
+		g_test.line = true;
+	}
+}
+
+void
+nes_bus_interrupt_clear(void)
+{
+	g_test.line = false;
+}
+
+uint8_t
+nes_bus_read(
+	__in int bus,
+	__in uint16_t address
+	)
+{
+	++g_test.read;
+
+	return g_test.data;
+}
+
+float
+nes_service_audio(
+	__in const int16_t *sample,
+	__in uint32_t count
+	)
+{
+
+	for(uint32_t index = 0; (index < count) && (g_test.sample_count < TEST_SAMPLE_MAX); ++index) {
+		g_test.sample[g_test.sample_count++] = sample[index];
+	}
+
+	return g_test.ratio;
+}
+
+void
+nes_test_initialize(void)
+{
+	g_test.data = 0;
+	g_test.interrupt = 0;
+	g_test.line = false;
+	g_test.ratio = 1.f;
+	g_test.read = 0;
+	g_test.sample_count = 0;
+	nes_audio_reset(&g_test.audio);
+}
+
+int
+nes_test_audio_blip(void)
+{
+	int result = NES_OK;
+
+	nes_test_initialize();
+	nes_audio_synchronize(&g_test.audio, 7);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_DMC_LOAD, 100);
+	nes_audio_synchronize(&g_test.audio, 1000);
+
+	if(ASSERT((g_test.audio.level[AUDIO_CHANNEL_DMC] == 100) && !g_test.audio.blip_level)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_resample(&g_test.audio);
+
+	if(ASSERT((g_test.audio.blip_cycle == ((1000 / AUDIO_BLIP_DIVIDER) * AUDIO_BLIP_DIVIDER))
+			&& (fabsf(g_test.audio.blip_level - (100 * AUDIO_MIX[AUDIO_CHANNEL_DMC])) < 0.0001f))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_audio_dmc(void)
+{
+	int result = NES_OK;
+
+	nes_test_initialize();
+	g_test.data = 0xff;
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_DMC_CONTROL, 0x8f);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_DMC_LOAD, 0x40);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_DMC_ADDRESS, 0x00);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_DMC_LENGTH, 0x00);
+
+	if(ASSERT((g_test.audio.dmc.start == AUDIO_DMC_ADDRESS)
+			&& (g_test.audio.dmc.length == 1)
+			&& (g_test.audio.dmc.period == AUDIO_DMC_PERIOD[15])
+			&& (g_test.audio.dmc.output == 0x40)
+			&& !g_test.read)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_STATUS, 0x10);
+
+	if(ASSERT((g_test.read == 1)
+			&& (g_test.interrupt == 1)
+			&& (g_test.audio.dmc.address == (AUDIO_DMC_ADDRESS + 1))
+			&& (nes_audio_port_read(&g_test.audio, AUDIO_PORT_STATUS) == 0x80))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_synchronize(&g_test.audio, AUDIO_DMC_PERIOD[0] + (15 * AUDIO_DMC_PERIOD[15]) - 1);
+
+	if(ASSERT(g_test.audio.dmc.output == 0x4e)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_synchronize(&g_test.audio, AUDIO_DMC_PERIOD[0] + (15 * AUDIO_DMC_PERIOD[15]));
+
+	if(ASSERT(g_test.audio.dmc.output == 0x50)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_synchronize(&g_test.audio, AUDIO_DMC_PERIOD[0] + (32 * AUDIO_DMC_PERIOD[15]));
+
+	if(ASSERT((g_test.audio.dmc.output == 0x50)
+			&& g_test.audio.dmc.silence
+			&& (g_test.read == 1)
+			&& (g_test.interrupt == 1))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_DMC_CONTROL, 0x0f);
+
+	if(ASSERT(!g_test.audio.status.dmc_interrupt)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_audio_frame(void)
+{
+	uint64_t event;
+	int result = NES_OK;
+
+	nes_test_initialize();
+	event = AUDIO_FRAME_RESET + AUDIO_FRAME_DELTA[AUDIO_MODE_4_STEP][0] + AUDIO_FRAME_DELTA[AUDIO_MODE_4_STEP][1]
+		+ AUDIO_FRAME_DELTA[AUDIO_MODE_4_STEP][2];
+
+	if(ASSERT((event == 29829) && (g_test.audio.event == event))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_synchronize(&g_test.audio, event - 1);
+
+	if(ASSERT(!g_test.interrupt && !g_test.audio.status.frame_interrupt)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_synchronize(&g_test.audio, event);
+
+	if(ASSERT((g_test.interrupt == 1)
+			&& (nes_audio_port_read(&g_test.audio, AUDIO_PORT_STATUS) == 0x40)
+			&& !nes_audio_port_read(&g_test.audio, AUDIO_PORT_STATUS)
+			&& (g_test.audio.event == (event + 29830)))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_test_initialize();
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_FRAME, 0x40);
+	nes_audio_synchronize(&g_test.audio, event * 4);
+
+	if(ASSERT((g_test.audio.event == AUDIO_EVENT_NONE)
+			&& !g_test.interrupt
+			&& !g_test.audio.status.frame_interrupt)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_test_initialize();
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_STATUS, 0x01);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_1_TIMER_HIGH, 0x00);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_FRAME, 0x80);
+
+	if(ASSERT((g_test.audio.event == AUDIO_EVENT_NONE)
+			&& (g_test.audio.pulse[0].length == (AUDIO_LENGTH[0] - 1)))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_synchronize(&g_test.audio, 37282);
+
+	if(ASSERT(!g_test.interrupt
+			&& (g_test.audio.pulse[0].length == (AUDIO_LENGTH[0] - 3))
+			&& !g_test.audio.frame.step)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_audio_interrupt(void)
+{
+	int result = NES_OK;
+	uint64_t event = AUDIO_FRAME_RESET + AUDIO_FRAME_DELTA[AUDIO_MODE_4_STEP][0] + AUDIO_FRAME_DELTA[AUDIO_MODE_4_STEP][1]
+		+ AUDIO_FRAME_DELTA[AUDIO_MODE_4_STEP][2];
+
+	nes_test_initialize();
+	nes_audio_synchronize(&g_test.audio, event);
+
+	if(ASSERT(g_test.line
+			&& (nes_audio_port_read(&g_test.audio, AUDIO_PORT_STATUS) == 0x40)
+			&& !g_test.line)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_test_initialize();
+	nes_audio_synchronize(&g_test.audio, event);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_FRAME, 0x40);
+
+	if(ASSERT(!g_test.line && !g_test.audio.status.frame_interrupt)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_test_initialize();
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_DMC_CONTROL, 0x8f);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_DMC_LENGTH, 0x00);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_STATUS, 0x10);
+
+	if(ASSERT(g_test.line && g_test.audio.status.dmc_interrupt)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_DMC_CONTROL, 0x0f);
+
+	if(ASSERT(!g_test.line && !g_test.audio.status.dmc_interrupt)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_test_initialize();
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_DMC_CONTROL, 0x8f);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_DMC_LENGTH, 0x00);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_STATUS, 0x10);
+	nes_audio_synchronize(&g_test.audio, event);
+
+	if(ASSERT(g_test.line
+			&& (nes_audio_port_read(&g_test.audio, AUDIO_PORT_STATUS) == 0xc0)
+			&& g_test.line)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_STATUS, 0x00);
+
+	if(ASSERT(!g_test.line && !g_test.audio.status.dmc_interrupt)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_audio_length(void)
+{
+	int result = NES_OK;
+
+	nes_test_initialize();
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_1_TIMER_HIGH, 0x08);
+
+	if(ASSERT(!g_test.audio.pulse[0].length)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_STATUS, 0x0f);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_1_TIMER_HIGH, 0x08);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_2_TIMER_HIGH, 0x10);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_TRIANGLE_TIMER_HIGH, 0x18);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_NOISE_LENGTH, 0x20);
+
+	if(ASSERT((g_test.audio.pulse[0].length == AUDIO_LENGTH[1])
+			&& (g_test.audio.pulse[1].length == AUDIO_LENGTH[2])
+			&& (g_test.audio.triangle.length == AUDIO_LENGTH[3])
+			&& (g_test.audio.noise.length == AUDIO_LENGTH[4])
+			&& (nes_audio_port_read(&g_test.audio, AUDIO_PORT_STATUS) == 0x0f))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_STATUS, 0x0a);
+
+	if(ASSERT(!g_test.audio.pulse[0].length
+			&& !g_test.audio.triangle.length
+			&& (nes_audio_port_read(&g_test.audio, AUDIO_PORT_STATUS) == 0x0a))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_STATUS, 0x01);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_1_TIMER_HIGH, 0x00);
+	nes_audio_synchronize(&g_test.audio, 14912);
+
+	if(ASSERT(g_test.audio.pulse[0].length == AUDIO_LENGTH[0])) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_synchronize(&g_test.audio, 14913);
+
+	if(ASSERT(g_test.audio.pulse[0].length == (AUDIO_LENGTH[0] - 1))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_synchronize(&g_test.audio, 29829);
+
+	if(ASSERT(g_test.audio.pulse[0].length == (AUDIO_LENGTH[0] - 2))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_1_CONTROL, 0x20);
+	nes_audio_synchronize(&g_test.audio, 29829 * 2);
+
+	if(ASSERT(g_test.audio.pulse[0].length == (AUDIO_LENGTH[0] - 2))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_audio_load(void)
+{
+	int result = NES_OK;
+
+	nes_test_initialize();
+
+	if(ASSERT((nes_audio_load(&g_test.audio, 0) == NES_OK)
+			&& (g_test.audio.rate == AUDIO_RATE_44100))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	if(ASSERT((nes_audio_load(&g_test.audio, 48000) == NES_OK)
+			&& (g_test.audio.rate == AUDIO_RATE_48000))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	if(ASSERT((nes_audio_load(&g_test.audio, 22050) == NES_ERR)
+			&& (g_test.audio.rate == AUDIO_RATE_48000))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_audio_noise(void)
+{
+	uint16_t shift = 1;
+	int result = NES_OK;
+
+	nes_test_initialize();
+	nes_audio_synchronize(&g_test.audio, AUDIO_NOISE_PERIOD[0] * 100);
+
+	for(uint32_t step = 0; step < 100; ++step) {
+		shift = (shift >> 1) | (((shift ^ (shift >> 1)) & 1) << 14);
+	}
+
+	if(ASSERT(g_test.audio.noise.shift == shift)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_NOISE_PERIOD, 0x80);
+	nes_audio_synchronize(&g_test.audio, AUDIO_NOISE_PERIOD[0] * 200);
+
+	for(uint32_t step = 0; step < 100; ++step) {
+		shift = (shift >> 1) | (((shift ^ (shift >> 6)) & 1) << 14);
+	}
+
+	if(ASSERT(g_test.audio.noise.shift == shift)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_audio_pulse(void)
+{
+	int result = NES_OK;
+	uint32_t crossing = 0;
+
+	nes_test_initialize();
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_STATUS, 0x01);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_1_CONTROL, 0xbf);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_1_TIMER_LOW, 0xfd);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_1_TIMER_HIGH, 0x08);
+
+	for(uint64_t frame = 1; frame <= FRAMES_PER_SEC; ++frame) {
+		nes_audio_flush(&g_test.audio, frame * CYCLES_PER_FRAME);
+
+		if(ASSERT(!g_test.audio.sample_count)) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+	for(uint32_t index = 1; index < g_test.sample_count; ++index) {
+
+		if((g_test.sample[index - 1] < 0) != (g_test.sample[index] < 0)) {
+			++crossing;
+		}
+	}
+
+	if(ASSERT((abs((int)g_test.sample_count - (int)(((uint64_t)FRAMES_PER_SEC * CYCLES_PER_FRAME * AUDIO_SAMPLE_RATE) / AUDIO_CLOCK))
+				<= AUDIO_RESAMPLE_TAPS)
+			&& (crossing >= 870) && (crossing <= 890))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_audio_ratio(void)
+{
+	uint32_t count;
+	int result = NES_OK;
+
+	nes_test_initialize();
+	g_test.ratio = 1.01f;
+	nes_audio_flush(&g_test.audio, CYCLES_PER_FRAME);
+
+	if(ASSERT(g_test.audio.step == (uint32_t)(AUDIO_CLOCK / g_test.ratio))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	for(uint64_t frame = 2; frame <= FRAMES_PER_SEC; ++frame) {
+		nes_audio_flush(&g_test.audio, frame * CYCLES_PER_FRAME);
+	}
+
+	count = ((uint64_t)FRAMES_PER_SEC * CYCLES_PER_FRAME * AUDIO_SAMPLE_RATE * g_test.ratio) / AUDIO_CLOCK;
+
+	if(ASSERT(abs((int)g_test.sample_count - (int)count) <= AUDIO_RESAMPLE_TAPS)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_audio_reset(void)
+{
+	int result = NES_OK;
+
+	nes_test_initialize();
+
+	if(ASSERT(!g_test.audio.cycle
+			&& (g_test.audio.event == 29829)
+			&& g_test.audio.dmc.empty
+			&& g_test.audio.dmc.silence
+			&& (g_test.audio.frame.timer == AUDIO_FRAME_RESET)
+			&& (g_test.audio.noise.shift == 1)
+			&& (g_test.audio.level[AUDIO_CHANNEL_TRIANGLE] == AUDIO_TRIANGLE[0])
+			&& !g_test.audio.blip_level
+			&& !g_test.audio.resample_count
+			&& !g_test.audio.sample_count
+			&& (g_test.audio.step == AUDIO_CLOCK)
+			&& !g_test.audio.status.raw)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_audio_sample(void)
+{
+	int result = NES_OK;
+
+	for(uint8_t rate = 0; rate < AUDIO_RATE_MAX; ++rate) {
+		nes_test_initialize();
+
+		if(ASSERT(nes_audio_load(&g_test.audio, AUDIO_RATE[rate]) == NES_OK)) {
+			result = NES_ERR;
+			goto exit;
+		}
+
+		for(uint64_t cycle = 0; cycle < AUDIO_CLOCK;) {
+			cycle = ((cycle + CYCLES_PER_FRAME) < AUDIO_CLOCK) ? (cycle + CYCLES_PER_FRAME) : AUDIO_CLOCK;
+			nes_audio_flush(&g_test.audio, cycle);
+		}
+
+		if(ASSERT((g_test.sample_count <= AUDIO_RATE[rate])
+				&& (g_test.sample_count >= (AUDIO_RATE[rate] - AUDIO_RESAMPLE_TAPS)))) {
+			result = NES_ERR;
+			goto exit;
+		}
+
+		for(uint32_t index = 0; index < g_test.sample_count; ++index) {
+
+			if(ASSERT(!g_test.sample[index])) {
+				result = NES_ERR;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_audio_sweep(void)
+{
+	int result = NES_OK;
+
+	nes_test_initialize();
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_1_TIMER_LOW, 0x00);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_1_TIMER_HIGH, 0x01);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_1_SWEEP, 0x81);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_2_TIMER_LOW, 0x00);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_2_TIMER_HIGH, 0x01);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_2_SWEEP, 0x89);
+	nes_audio_synchronize(&g_test.audio, 14913);
+
+	if(ASSERT((g_test.audio.pulse[0].period == 0x0180) && (g_test.audio.pulse[1].period == 0x0080))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_test_initialize();
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_1_TIMER_LOW, 0x00);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_1_TIMER_HIGH, 0x01);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_1_SWEEP, 0x89);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_2_TIMER_LOW, 0xf0);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_2_TIMER_HIGH, 0x07);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_PULSE_2_SWEEP, 0x81);
+	nes_audio_synchronize(&g_test.audio, 14913);
+
+	if(ASSERT((g_test.audio.pulse[0].period == 0x007f) && (g_test.audio.pulse[1].period == 0x07f0))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_audio_triangle(void)
+{
+	int result = NES_OK;
+
+	nes_test_initialize();
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_STATUS, 0x04);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_TRIANGLE_CONTROL, 0x7f);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_TRIANGLE_TIMER_LOW, 0x10);
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_TRIANGLE_TIMER_HIGH, 0x08);
+	nes_audio_synchronize(&g_test.audio, AUDIO_FRAME_RESET);
+
+	if(ASSERT(!g_test.audio.triangle.sequence
+			&& (g_test.audio.triangle.linear == 0x7f)
+			&& !g_test.audio.triangle.linear_reload)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_synchronize(&g_test.audio, 1 + (17 * 443));
+
+	if(ASSERT(g_test.audio.triangle.sequence == 5)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_audio_port_write(&g_test.audio, AUDIO_PORT_STATUS, 0x00);
+	nes_audio_synchronize(&g_test.audio, 1 + (17 * 453));
+
+	if(ASSERT(!g_test.audio.triangle.length && (g_test.audio.triangle.sequence == 5))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+main(
+	__in int argc,
+	__in char *argv[]
+	)
+{
+	int result = NES_OK, seed;
+
+	if(argc > 1) {
+		seed = strtol(argv[1], NULL, 16);
+	} else {
+		seed = time(NULL);
+	}
+
+	srand(seed);
+	TRACE_SEED(seed);
+
+	for(size_t test = 0; test < TEST_COUNT(TEST); ++test) {
+
+		if(TEST[test]() != NES_OK) {
+			result = NES_ERR;
+		}
+	}
+
+	return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
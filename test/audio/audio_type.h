@@ -0,0 +1,93 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NES_TEST_AUDIO_TYPE_H_
+#define NES_TEST_AUDIO_TYPE_H_
+
+#include "../../src/system/audio_type.h"
+#include "../common.h"
+
+#define TEST_SAMPLE_MAX (AUDIO_SAMPLE_RATE * 2)
+
+typedef struct {
+        nes_audio_t audio;
+        uint8_t data;
+        uint32_t interrupt;
+        bool line;
+        float ratio;
+        uint16_t read;
+        int16_t sample[TEST_SAMPLE_MAX];
+        uint32_t sample_count;
+} nes_test_audio_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+int nes_test_audio_blip(void);
+
+int nes_test_audio_dmc(void);
+
+int nes_test_audio_frame(void);
+
+int nes_test_audio_interrupt(void);
+
+int nes_test_audio_length(void);
+
+int nes_test_audio_load(void);
+
+int nes_test_audio_noise(void);
+
+int nes_test_audio_pulse(void);
+
+int nes_test_audio_ratio(void);
+
+int nes_test_audio_reset(void);
+
+int nes_test_audio_sample(void);
+
+int nes_test_audio_sweep(void);
+
+int nes_test_audio_triangle(void);
+
+void nes_test_initialize(void);
+
+static const nes_test TEST[] = {
+        nes_test_audio_blip,
+        nes_test_audio_dmc,
+        nes_test_audio_frame,
+        nes_test_audio_interrupt,
+        nes_test_audio_length,
+        nes_test_audio_load,
+        nes_test_audio_noise,
+        nes_test_audio_pulse,
+        nes_test_audio_ratio,
+        nes_test_audio_reset,
+        nes_test_audio_sample,
+        nes_test_audio_sweep,
+        nes_test_audio_triangle,
+	};
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NES_TEST_AUDIO_TYPE_H_ */
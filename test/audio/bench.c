@@ -0,0 +1,137 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./bench_type.h"
+
+static nes_bench_audio_data_t g_bench = {};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void
+nes_bus_interrupt(
+	__in bool maskable
+	)
+{
+	return;
+}
+
+void
+nes_bus_interrupt_clear(void)
+{
+	return;
+}
+
+uint8_t
+nes_bus_read(
+	__in int bus,
+	__in uint16_t address
+	)
+{
+	return address;
+}
+
+float
+nes_service_audio(
+	__in const int16_t *sample,
+	__in uint32_t count
+	)
+{
+	g_bench.sample_count += count;
+
+	return 1.f;
+}
+
+int
+nes_bench_audio(
+	__in const char *name
+	)
+{
+	double elapsed;
+	int result = NES_OK;
+	struct timespec begin, end;
+
+	nes_audio_reset(&g_bench.audio);
+	g_bench.sample_count = 0;
+	timespec_get(&begin, TIME_UTC);
+
+	for(uint64_t frame = 0; frame < BENCH_FRAMES; ++frame) {
+
+		for(uint32_t write = 0; write < BENCH_WRITES; ++write) {
+			const nes_bench_audio_write_t *entry = &g_bench.log[frame][write];
+
+			nes_audio_synchronize(&g_bench.audio, (frame * CYCLES_PER_FRAME) + entry->cycle);
+			nes_audio_port_write(&g_bench.audio, entry->address, entry->data);
+		}
+
+		nes_audio_flush(&g_bench.audio, (frame + 1) * CYCLES_PER_FRAME);
+	}
+
+	timespec_get(&end, TIME_UTC);
+	elapsed = (end.tv_sec - begin.tv_sec) + ((end.tv_nsec - begin.tv_nsec) / 1e9);
+	TRACE_BENCH(name, elapsed, g_bench.sample_count);
+
+	return result;
+}
+
+int
+main(
+	__in int argc,
+	__in char *argv[]
+	)
+{
+	int result = NES_OK, seed;
+
+	if(argc > 1) {
+		seed = strtol(argv[1], NULL, 16);
+	} else {
+		seed = time(NULL);
+	}
+
+	srand(seed);
+	TRACE_SEED(seed);
+
+	for(uint32_t frame = 0; frame < BENCH_FRAMES; ++frame) {
+		nes_bench_audio_write_t *entry = g_bench.log[frame];
+
+		entry->address = AUDIO_PORT_STATUS;
+		entry->cycle = 0;
+		entry->data = 0x1f;
+
+		for(uint32_t write = 1; write < BENCH_WRITES; ++write) {
+			entry = &g_bench.log[frame][write];
+			entry->address = rand() % (AUDIO_PORT_DMC_LENGTH + 1);
+			entry->cycle = (write * CYCLES_PER_FRAME) / BENCH_WRITES;
+			entry->data = rand();
+		}
+	}
+
+	if(nes_bench_audio("apu") != NES_OK) {
+		result = NES_ERR;
+	}
+
+	return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
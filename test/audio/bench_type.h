@@ -0,0 +1,60 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NES_BENCH_AUDIO_TYPE_H_
+#define NES_BENCH_AUDIO_TYPE_H_
+
+#include "../../src/system/audio_type.h"
+#include "../common.h"
+
+#define BENCH_FRAMES (FRAMES_PER_SEC * 60)
+#define BENCH_WRITES 16
+
+#define TRACE_BENCH(_NAME_, _ELAPSED_, _SAMPLES_) \
+	fprintf(stdout, "[%sBENCH%s] %s (%u writes/frame): %.3f ms/frame, %.1fx realtime, %llu samples\n", LEVEL_COLOR(LEVEL_INFORMATION), \
+		LEVEL_COLOR(LEVEL_MAX), _NAME_, BENCH_WRITES, ((_ELAPSED_) * MILLISEC_PER_SEC) / BENCH_FRAMES, \
+		(BENCH_FRAMES / (float)FRAMES_PER_SEC) / (_ELAPSED_), (unsigned long long)(_SAMPLES_))
+
+typedef struct {
+	uint16_t address;
+	uint32_t cycle;
+	uint8_t data;
+} nes_bench_audio_write_t;
+
+typedef struct {
+	nes_audio_t audio;
+	nes_bench_audio_write_t log[BENCH_FRAMES][BENCH_WRITES];
+	uint64_t sample_count;
+} nes_bench_audio_data_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+int nes_bench_audio(
+	__in const char *name
+	);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NES_BENCH_AUDIO_TYPE_H_ */
@@ -27,12 +27,91 @@ static nes_test_bus_t g_test = {};
 extern "C" {
 #endif /* __cplusplus */
 
+int
+nes_audio_load(
+        __inout nes_audio_t *audio,
+        __in unsigned rate
+        )
+{
+	return NES_OK;
+}
+
+uint8_t
+nes_audio_port_read(
+        __inout nes_audio_t *audio,
+        __in uint16_t address
+        )
+{
+	g_test.address.word = address;
+
+	return g_test.data.low;
+}
+
+void
+nes_audio_port_write(
+        __inout nes_audio_t *audio,
+        __in uint16_t address,
+        __in uint8_t data
+        )
+{
+	g_test.address.word = address;
+	g_test.data.low = data;
+}
+
+void
+nes_audio_reset(
+        __inout nes_audio_t *audio
+        )
+{
+	g_test.audio_reset = true;
+}
+
+void
+nes_audio_synchronize(
+        __inout nes_audio_t *audio,
+        __in uint64_t cycle
+        )
+{
+	return;
+}
+
+uint8_t
+nes_input_port_read(
+        __inout nes_input_t *input,
+        __in uint8_t controller
+        )
+{
+	g_test.address.word = controller;
+
+	return g_test.data.low;
+}
+
+void
+nes_input_port_write(
+        __inout nes_input_t *input,
+        __in uint8_t data
+        )
+{
+	g_test.data.low = data;
+}
+
+void
+nes_input_reset(
+        __inout nes_input_t *input
+        )
+{
+	g_test.input_reset = true;
+}
+
 int
 nes_mapper_load(
 	__in const nes_t *configuration,
 	__inout nes_mapper_t *mapper
 	)
 {
+	mapper->cartridge.ram[RAM_PROGRAM].ptr = g_test.ram_program;
+	mapper->cartridge.ram[RAM_PROGRAM].length = sizeof(g_test.ram_program);
+
 	return g_test.mapper_status;
 }
 
@@ -96,6 +175,42 @@ nes_mapper_unload(
 	g_test.mapper_unload = true;
 }
 
+int
+nes_movie_load(
+	__in const nes_t *configuration,
+	__inout nes_movie_t *movie
+	)
+{
+	g_test.movie_load = true;
+
+	return NES_OK;
+}
+
+void
+nes_movie_unload(
+	__inout nes_movie_t *movie
+	)
+{
+	g_test.movie_unload = true;
+}
+
+void
+nes_processor_interrupt(
+        __inout nes_processor_t *processor,
+        __in bool maskable
+        )
+{
+	return;
+}
+
+void
+nes_processor_interrupt_clear(
+        __inout nes_processor_t *processor
+        )
+{
+	return;
+}
+
 void
 nes_processor_reset(
         __inout nes_processor_t *processor
@@ -127,6 +242,64 @@ nes_service_unload(void)
 	return;
 }
 
+int
+nes_video_band_load(
+        __inout nes_video_t *video,
+        __in unsigned count
+        )
+{
+	return NES_OK;
+}
+
+void
+nes_video_band_unload(
+        __inout nes_video_t *video
+        )
+{
+	return;
+}
+
+void
+nes_video_invalidate(
+        __inout nes_video_t *video,
+        __in uint16_t address
+        )
+{
+	++g_test.video_invalidate;
+}
+
+int
+nes_video_pipeline_load(
+        __inout nes_video_t *video
+        )
+{
+	return NES_OK;
+}
+
+void
+nes_video_pipeline_unload(
+        __inout nes_video_t *video
+        )
+{
+	return;
+}
+
+int
+nes_video_surface_load(
+        __inout nes_video_t *video
+        )
+{
+	return NES_OK;
+}
+
+void
+nes_video_surface_unload(
+        __inout nes_video_t *video
+        )
+{
+	return;
+}
+
 uint8_t
 nes_video_port_read(
         __inout nes_video_t *video,
@@ -157,6 +330,15 @@ nes_video_reset(
 	g_test.video_reset = true;
 }
 
+void
+nes_video_synchronize(
+        __inout nes_video_t *video,
+        __in uint64_t cycle
+        )
+{
+	return;
+}
+
 const nes_version_t *
 nes_version(void)
 {
@@ -172,6 +354,8 @@ nes_test_bus_load(void)
 	g_test.mapper_status = NES_ERR;
 
 	if(ASSERT((nes_bus_load(&g_test.configuration) != NES_OK)
+			&& !g_test.audio_reset
+			&& !g_test.input_reset
 			&& !g_test.processor_reset
 			&& !g_test.video_reset
 			&& !nes_bus()->loaded)) {
@@ -182,6 +366,9 @@ nes_test_bus_load(void)
 	nes_test_initialize();
 
 	if(ASSERT((nes_bus_load(&g_test.configuration) == NES_OK)
+			&& g_test.audio_reset
+			&& g_test.input_reset
+			&& g_test.movie_load
 			&& g_test.processor_reset
 			&& g_test.video_reset
 			&& nes_bus()->loaded)) {
@@ -247,6 +434,25 @@ nes_test_bus_read(void)
 					goto exit;
 				}
 				break;
+			case AUDIO_STATUS:
+				g_test.data.low = rand();
+
+				if(ASSERT((nes_bus_read(BUS_PROCESSOR, address) == g_test.data.low)
+						&& (g_test.address.word == AUDIO_PORT_STATUS))) {
+					result = NES_ERR;
+					goto exit;
+				}
+				break;
+			case INPUT_CONTROLLER_1:
+			case INPUT_CONTROLLER_2:
+				g_test.data.low = rand();
+
+				if(ASSERT((nes_bus_read(BUS_PROCESSOR, address) == g_test.data.low)
+						&& (g_test.address.word == (address - INPUT_CONTROLLER_1)))) {
+					result = NES_ERR;
+					goto exit;
+				}
+				break;
 			case PROCESSOR_WORK_RAM_BEGIN ... PROCESSOR_WORK_RAM_END:
 				g_test.data.low = rand();
 
@@ -326,6 +532,162 @@ exit:
 	return result;
 }
 
+int
+nes_test_bus_rewind(void)
+{
+	int result = NES_OK;
+	nes_bus_t *bus = nes_bus();
+	uint8_t ram_processor[PROCESSOR_RAM_WIDTH], ram_video[VIDEO_RAM_WIDTH];
+
+	nes_test_initialize();
+	g_test.configuration.replay.mode = NES_REPLAY_RECORD;
+	g_test.configuration.replay.rewind = 1;
+
+	if(ASSERT((nes_bus_load(&g_test.configuration) != NES_OK)
+			&& !bus->rewind.enabled)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_test_initialize();
+	g_test.configuration.replay.mode = NES_REPLAY_PLAYBACK;
+	g_test.configuration.replay.rewind = 1;
+
+	if(ASSERT((nes_bus_load(&g_test.configuration) != NES_OK)
+			&& !bus->rewind.enabled)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_test_initialize();
+	g_test.configuration.replay.rewind = 1;
+
+	if(ASSERT((nes_bus_load(&g_test.configuration) == NES_OK)
+			&& bus->rewind.enabled
+			&& (nes_bus_rewind_pop() == NES_EVT))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	memcpy(ram_processor, bus->ram_processor.ptr, PROCESSOR_RAM_WIDTH);
+	memcpy(ram_video, bus->ram_video.ptr, VIDEO_RAM_WIDTH);
+	bus->cycle = rand();
+	nes_bus_write(BUS_PROCESSOR, rand() % PROCESSOR_RAM_WIDTH, rand());
+	nes_bus_write(BUS_VIDEO, VIDEO_RAM_BEGIN + (rand() % VIDEO_RAM_WIDTH), rand());
+	nes_bus_rewind_push();
+	bus->cycle = rand();
+	nes_bus_write(BUS_PROCESSOR, rand() % PROCESSOR_RAM_WIDTH, rand());
+	nes_bus_write(BUS_VIDEO, VIDEO_RAM_BEGIN + (rand() % VIDEO_RAM_WIDTH), rand());
+	nes_bus_rewind_push();
+
+	nes_bus_write(BUS_PROCESSOR, PROCESSOR_WORK_RAM_BEGIN + (3 * PAGE_WIDTH) + 5, rand());
+
+	for(size_t page = bus->rewind.ring.page[BUS_REWIND_PROGRAM]; page < bus->rewind.ring.page[BUS_REWIND_PROGRAM + 1]; ++page) {
+
+		if(ASSERT(bus->rewind.ring.dirty.ptr[page] == (page == (bus->rewind.ring.page[BUS_REWIND_PROGRAM] + 3)))) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+	nes_bus_rewind_push();
+
+	if(ASSERT((bus->rewind.ring.count == 3)
+			&& (nes_bus_rewind_pop() == NES_OK)
+			&& (nes_bus_rewind_pop() == NES_OK)
+			&& (nes_bus_rewind_pop() == NES_OK)
+			&& (nes_bus_rewind_pop() == NES_EVT)
+			&& !bus->cycle
+			&& !memcmp(bus->ram_processor.ptr, ram_processor, PROCESSOR_RAM_WIDTH)
+			&& !memcmp(bus->ram_video.ptr, ram_video, VIDEO_RAM_WIDTH))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_bus_state(void)
+{
+	int result = NES_OK;
+	nes_bus_t *bus = nes_bus();
+
+	nes_test_initialize();
+	g_test.configuration.display.runahead = BUS_RUNAHEAD_MAX + 1;
+
+	if(ASSERT((nes_bus_load(&g_test.configuration) != NES_OK)
+			&& !bus->runahead)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_test_initialize();
+	g_test.configuration.display.runahead = BUS_RUNAHEAD_MAX;
+
+	if(ASSERT((nes_bus_load(&g_test.configuration) == NES_OK)
+			&& (bus->runahead == BUS_RUNAHEAD_MAX))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	for(uint32_t address = 0; address < OBJECT_RAM_WIDTH; ++address) {
+		bus->ram_object.ptr[address] = rand();
+	}
+
+	for(uint32_t address = 0; address < PROCESSOR_RAM_WIDTH; ++address) {
+		bus->ram_processor.ptr[address] = rand();
+	}
+
+	for(uint32_t address = 0; address < VIDEO_RAM_WIDTH; ++address) {
+		bus->ram_video.ptr[address] = rand();
+	}
+
+	for(uint32_t address = 0; address < VIDEO_PALETTE_RAM_WIDTH; ++address) {
+		bus->ram_video_palette.ptr[address] = rand();
+	}
+
+	bus->audio.cycle = rand();
+	bus->cycle = rand();
+	bus->input.shift[NES_CONTROLLER_1] = rand();
+	bus->processor.accumulator.low = rand();
+	bus->video.frame = rand();
+	nes_bus_save(&bus->state);
+
+	bus->ram_object.ptr[rand() % OBJECT_RAM_WIDTH] ^= 0xff;
+	bus->ram_processor.ptr[rand() % PROCESSOR_RAM_WIDTH] ^= 0xff;
+	bus->ram_video.ptr[rand() % VIDEO_RAM_WIDTH] ^= 0xff;
+	bus->ram_video_palette.ptr[rand() % VIDEO_PALETTE_RAM_WIDTH] ^= 0xff;
+	++bus->audio.cycle;
+	++bus->cycle;
+	bus->input.shift[NES_CONTROLLER_1] ^= 0xff;
+	bus->processor.accumulator.low ^= 0xff;
+	++bus->video.frame;
+	nes_bus_restore(&bus->state);
+
+	if(ASSERT(!memcmp(bus->ram_object.ptr, bus->state.ram_object, OBJECT_RAM_WIDTH)
+			&& !memcmp(bus->ram_processor.ptr, bus->state.ram_processor, PROCESSOR_RAM_WIDTH)
+			&& !memcmp(bus->ram_video.ptr, bus->state.ram_video, VIDEO_RAM_WIDTH)
+			&& !memcmp(bus->ram_video_palette.ptr, bus->state.ram_video_palette, VIDEO_PALETTE_RAM_WIDTH)
+			&& (bus->audio.cycle == bus->state.core.audio.cycle)
+			&& (bus->cycle == bus->state.core.cycle)
+			&& (bus->input.shift[NES_CONTROLLER_1] == bus->state.core.input.shift[NES_CONTROLLER_1])
+			&& (bus->processor.accumulator.low == bus->state.core.processor.accumulator.low)
+			&& (bus->video.frame == bus->state.core.video.frame)
+			&& (g_test.video_invalidate == 1))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
 int
 nes_test_bus_unload(void)
 {
@@ -336,6 +698,7 @@ nes_test_bus_unload(void)
 	nes_bus_unload();
 
 	if(ASSERT(g_test.mapper_unload
+			&& g_test.movie_unload
 			&& !nes_bus()->loaded)) {
 		result = NES_ERR;
 		goto exit;
@@ -401,6 +764,16 @@ nes_test_bus_write(void)
 					goto exit;
 				}
 				break;
+			case AUDIO_PORT_BEGIN ... AUDIO_PORT_END:
+			case AUDIO_STATUS:
+			case AUDIO_FRAME:
+				nes_bus_write(BUS_PROCESSOR, address, data = rand());
+
+				if(ASSERT((g_test.address.word == (address - AUDIO_PORT_BEGIN)) && (g_test.data.low == data))) {
+					result = NES_ERR;
+					goto exit;
+				}
+				break;
 			case PROCESSOR_TRANSFER:
 				nes_bus_write(BUS_PROCESSOR, address, data = rand());
 
@@ -409,6 +782,14 @@ nes_test_bus_write(void)
 					goto exit;
 				}
 				break;
+			case INPUT_CONTROLLER_1:
+				nes_bus_write(BUS_PROCESSOR, address, data = rand());
+
+				if(ASSERT(g_test.data.low == data)) {
+					result = NES_ERR;
+					goto exit;
+				}
+				break;
 			case PROCESSOR_WORK_RAM_BEGIN ... PROCESSOR_WORK_RAM_END:
 				g_test.data.low = rand();
 
@@ -25,15 +25,23 @@
 #include "../../src/bus_type.h"
 #include "../common.h"
 
+#define TEST_RAM_PROGRAM_WIDTH (8 * BYTES_PER_KBYTE)
+
 typedef struct {
         nes_t configuration;
         nes_register_t address;
+        bool audio_reset;
         nes_register_t data;
+        bool input_reset;
         int mapper_status;
         int mapper_type;
         bool mapper_unload;
+        bool movie_load;
+        bool movie_unload;
         bool processor_reset;
+        uint8_t ram_program[TEST_RAM_PROGRAM_WIDTH];
         nes_version_t version;
+        unsigned video_invalidate;
         bool video_reset;
 } nes_test_bus_t;
 
@@ -45,6 +53,10 @@ int nes_test_bus_load(void);
 
 int nes_test_bus_read(void);
 
+int nes_test_bus_rewind(void);
+
+int nes_test_bus_state(void);
+
 int nes_test_bus_unload(void);
 
 int nes_test_bus_write(void);
@@ -56,6 +68,8 @@ void nes_test_uninitialize(void);
 static const nes_test TEST[] = {
         nes_test_bus_load,
         nes_test_bus_read,
+        nes_test_bus_rewind,
+        nes_test_bus_state,
         nes_test_bus_unload,
         nes_test_bus_write,
 	};
@@ -0,0 +1,99 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./bench_type.h"
+
+static nes_bench_filter_data_t g_bench = {};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+int
+nes_bench_filter(
+	__in const nes_bench_filter_t *bench
+	)
+{
+	double elapsed;
+	int result = NES_OK;
+	struct timespec begin, end;
+	const void *input = (bench->format == NES_FORMAT_INDEXED8) ? (const void *)g_bench.input_indexed : (const void *)g_bench.input;
+
+	if(bench->filter == NES_FILTER_NTSC) {
+		input = g_bench.input_color;
+	}
+
+	timespec_get(&begin, TIME_UTC);
+
+	for(uint32_t iteration = 0; iteration < BENCH_ITERATIONS; ++iteration) {
+
+		if((result = nes_filter(bench->filter, bench->format, input, g_bench.output, VIDEO_WIDTH, VIDEO_HEIGHT)) != NES_OK) {
+			goto exit;
+		}
+	}
+
+	timespec_get(&end, TIME_UTC);
+	elapsed = (end.tv_sec - begin.tv_sec) + ((end.tv_nsec - begin.tv_nsec) / 1e9);
+	TRACE_BENCH(bench->name, BENCH_FORMAT[bench->format], elapsed);
+
+exit:
+	return result;
+}
+
+int
+main(
+	__in int argc,
+	__in char *argv[]
+	)
+{
+	int result = NES_OK, seed;
+
+	if(argc > 1) {
+		seed = strtol(argv[1], NULL, 16);
+	} else {
+		seed = time(NULL);
+	}
+
+	srand(seed);
+	TRACE_SEED(seed);
+
+	for(uint32_t y = 0; y < VIDEO_HEIGHT; ++y) {
+
+		for(uint32_t x = 0; x < VIDEO_WIDTH; ++x) {
+			g_bench.input_color[y][x] = rand() % VIDEO_COLOR_MAX;
+			g_bench.input_indexed[y][x] = rand() % BENCH_COLORS;
+			g_bench.input[y][x] = 0xff000000 | (g_bench.input_indexed[y][x] * 0x00402010);
+		}
+	}
+
+	for(size_t bench = 0; bench < TEST_COUNT(BENCH); ++bench) {
+
+		if(nes_bench_filter(&BENCH[bench]) != NES_OK) {
+			result = NES_ERR;
+		}
+	}
+
+	return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,76 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NES_BENCH_FILTER_TYPE_H_
+#define NES_BENCH_FILTER_TYPE_H_
+
+#include "../../src/common/filter_type.h"
+#include "../common.h"
+
+#define BENCH_COLORS 4
+#define BENCH_ITERATIONS 500
+
+#define TRACE_BENCH(_NAME_, _FORMAT_, _ELAPSED_) \
+	fprintf(stdout, "[%sBENCH%s] %s (%s): %.3f ms/frame, %.1f frames/sec\n", LEVEL_COLOR(LEVEL_INFORMATION), LEVEL_COLOR(LEVEL_MAX), \
+		_NAME_, _FORMAT_, ((_ELAPSED_) * MILLISEC_PER_SEC) / BENCH_ITERATIONS, BENCH_ITERATIONS / (_ELAPSED_))
+
+typedef struct {
+	const char *name;
+	int filter;
+	int format;
+} nes_bench_filter_t;
+
+typedef struct {
+	uint32_t input[VIDEO_HEIGHT][VIDEO_WIDTH];
+	uint16_t input_color[VIDEO_HEIGHT][VIDEO_WIDTH];
+	uint8_t input_indexed[VIDEO_HEIGHT][VIDEO_WIDTH];
+	uint32_t output[VIDEO_HEIGHT * 3][VIDEO_WIDTH * 3];
+} nes_bench_filter_data_t;
+
+static const char *BENCH_FORMAT[] = {
+	"argb8888", /* NES_FORMAT_ARGB8888 */
+	"rgb565", /* NES_FORMAT_RGB565 */
+	"indexed8", /* NES_FORMAT_INDEXED8 */
+	};
+
+static const nes_bench_filter_t BENCH[] = {
+	{ "none", NES_FILTER_NONE, NES_FORMAT_ARGB8888 },
+	{ "scale2x", NES_FILTER_SCALE2X, NES_FORMAT_ARGB8888 },
+	{ "scale2x", NES_FILTER_SCALE2X, NES_FORMAT_INDEXED8 },
+	{ "scale3x", NES_FILTER_SCALE3X, NES_FORMAT_ARGB8888 },
+	{ "scale3x", NES_FILTER_SCALE3X, NES_FORMAT_INDEXED8 },
+	{ "hq2x", NES_FILTER_HQ2X, NES_FORMAT_ARGB8888 },
+	{ "ntsc", NES_FILTER_NTSC, NES_FORMAT_ARGB8888 },
+	};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+int nes_bench_filter(
+	__in const nes_bench_filter_t *bench
+	);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NES_BENCH_FILTER_TYPE_H_ */
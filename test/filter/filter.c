@@ -0,0 +1,410 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./filter_type.h"
+
+static nes_test_filter_t g_test = {};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+uint32_t
+nes_test_blend(
+	__in uint32_t center,
+	__in uint32_t first,
+	__in uint32_t second
+	)
+{
+	uint32_t result = 0;
+
+	for(uint32_t shift = 0; shift < 32; shift += 8) {
+		result |= (((((center >> shift) & 0xff) * 2) + ((first >> shift) & 0xff) + ((second >> shift) & 0xff)) / 4) << shift;
+	}
+
+	return result;
+}
+
+bool
+nes_test_different(
+	__in uint32_t first,
+	__in uint32_t second
+	)
+{
+	int red = (int)((first >> 16) & 0xff) - (int)((second >> 16) & 0xff), green = (int)((first >> 8) & 0xff) - (int)((second >> 8) & 0xff),
+		blue = (int)(first & 0xff) - (int)(second & 0xff);
+
+	return (abs((red + green + blue) >> 2) > FILTER_HQ_Y) || (abs((red - blue) >> 2) > FILTER_HQ_U) || (abs(((2 * green) - red - blue) >> 3) > FILTER_HQ_V);
+}
+
+uint32_t
+nes_test_ntsc(
+	__in uint32_t x,
+	__in uint32_t y,
+	__in int output,
+	__in bool scanline
+	)
+{
+	float yiq[3] = {};
+	uint32_t result = 0xff000000;
+	int center = ((2 * x) + output) * 4 + 2;
+
+	for(int offset = center - 6; offset < center + 6; ++offset) {
+		int neighbor = (offset < 0) ? 0 : (((offset / 8) >= TEST_WIDTH) ? (TEST_WIDTH - 1) : (offset / 8));
+		int phase = ((4 * y) + offset + 12) % 12;
+		uint16_t color = g_test.input_color[y][neighbor];
+		float level;
+
+		if(color & VIDEO_COLOR_GRAYSCALE) {
+			color &= VIDEO_COLOR_EMPHASIS | 0x30;
+		}
+
+		level = nes_filter_ntsc_signal(color & (VIDEO_COLOR_GRAYSCALE - 1), phase) / 12.f;
+		yiq[0] += level;
+		yiq[1] += level * FILTER_NTSC_CHROMA[phase][0];
+		yiq[2] += level * FILTER_NTSC_CHROMA[phase][1];
+	}
+
+	for(int channel = 0; channel < 3; ++channel) {
+		float value = ((FILTER_NTSC_RGB[channel][0] * yiq[0]) + (FILTER_NTSC_RGB[channel][1] * yiq[1]) + (FILTER_NTSC_RGB[channel][2] * yiq[2])) * 255.f;
+
+		value = (value < 0.f) ? 0.f : ((value > 255.f) ? 255.f : value);
+
+		if(scanline) {
+			value *= 0.75f;
+		}
+
+		result |= (uint32_t)(value + 0.5f) << (8 * (2 - channel));
+	}
+
+	return result;
+}
+
+void
+nes_test_initialize(
+	__in uint32_t colors
+	)
+{
+
+	for(uint32_t y = 0; y < TEST_HEIGHT; ++y) {
+
+		for(uint32_t x = 0; x < TEST_WIDTH; ++x) {
+			g_test.input_color[y][x] = rand() % VIDEO_COLOR_MAX;
+			g_test.input_indexed[y][x] = rand() % colors;
+			g_test.input[y][x] = 0xff000000 | (g_test.input_indexed[y][x] * 0x00402010);
+		}
+	}
+
+	memset(g_test.output, 0, sizeof(g_test.output));
+	memset(g_test.output_indexed, 0, sizeof(g_test.output_indexed));
+	memset(g_test.reference, 0, sizeof(g_test.reference));
+	memset(g_test.reference_indexed, 0, sizeof(g_test.reference_indexed));
+}
+
+int
+nes_test_filter(void)
+{
+	int result = NES_OK;
+
+	nes_test_initialize(4);
+
+	if(ASSERT((nes_filter(NES_FILTER_MAX, NES_FORMAT_ARGB8888, g_test.input, g_test.output, TEST_WIDTH, TEST_HEIGHT) == NES_ERR)
+			&& (nes_filter(NES_FILTER_SCALE2X, NES_FORMAT_MAX, g_test.input, g_test.output, TEST_WIDTH, TEST_HEIGHT) == NES_ERR)
+			&& (nes_filter(NES_FILTER_SCALE2X, NES_FORMAT_RGB565, g_test.input, g_test.output, TEST_WIDTH, TEST_HEIGHT) == NES_ERR)
+			&& (nes_filter(NES_FILTER_HQ2X, NES_FORMAT_INDEXED8, g_test.input, g_test.output, TEST_WIDTH, TEST_HEIGHT) == NES_ERR)
+			&& (nes_filter(NES_FILTER_SCALE2X, NES_FORMAT_ARGB8888, NULL, g_test.output, TEST_WIDTH, TEST_HEIGHT) == NES_ERR)
+			&& (nes_filter(NES_FILTER_SCALE2X, NES_FORMAT_ARGB8888, g_test.input, g_test.output, FILTER_WIDTH_MAX + 1, 1) == NES_ERR)
+			&& (nes_filter(NES_FILTER_SCALE2X, NES_FORMAT_ARGB8888, g_test.input, g_test.output, TEST_WIDTH, 0) == NES_ERR))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	if(ASSERT((nes_filter(NES_FILTER_NONE, NES_FORMAT_ARGB8888, g_test.input, g_test.output, TEST_WIDTH, TEST_HEIGHT) == NES_OK)
+			&& !memcmp(g_test.input, g_test.output, sizeof(g_test.input)))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_filter_hq2x(void)
+{
+	int result = NES_OK;
+	uint32_t blended = 0;
+
+	nes_test_initialize(4);
+
+	for(int y = 0; y < TEST_HEIGHT; ++y) {
+
+		for(int x = 0; x < TEST_WIDTH; ++x) {
+			uint32_t b = TEST_PIXEL(g_test.input, x, y - 1), d = TEST_PIXEL(g_test.input, x - 1, y), e = g_test.input[y][x],
+				f = TEST_PIXEL(g_test.input, x + 1, y), h = TEST_PIXEL(g_test.input, x, y + 1);
+			bool edge = nes_test_different(b, h) && nes_test_different(d, f);
+
+			((uint32_t *)g_test.reference)[TEST_INDEX(2, 2 * x, 2 * y)] = (edge && !nes_test_different(d, b)) ? nes_test_blend(e, d, b) : e;
+			((uint32_t *)g_test.reference)[TEST_INDEX(2, (2 * x) + 1, 2 * y)] = (edge && !nes_test_different(b, f)) ? nes_test_blend(e, b, f) : e;
+			((uint32_t *)g_test.reference)[TEST_INDEX(2, 2 * x, (2 * y) + 1)] = (edge && !nes_test_different(d, h)) ? nes_test_blend(e, d, h) : e;
+			((uint32_t *)g_test.reference)[TEST_INDEX(2, (2 * x) + 1, (2 * y) + 1)] = (edge && !nes_test_different(h, f)) ? nes_test_blend(e, h, f) : e;
+			blended += (edge && !nes_test_different(d, b));
+		}
+	}
+
+	if(ASSERT(nes_filter(NES_FILTER_HQ2X, NES_FORMAT_ARGB8888, g_test.input, g_test.output, TEST_WIDTH, TEST_HEIGHT) == NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	if(ASSERT(blended && !memcmp(g_test.output, g_test.reference, TEST_WIDTH * TEST_HEIGHT * 4 * sizeof(uint32_t)))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_filter_ntsc(void)
+{
+	int result = NES_OK;
+
+	nes_test_initialize(4);
+
+	if(ASSERT((nes_filter(NES_FILTER_NTSC, NES_FORMAT_INDEXED8, g_test.input_color, g_test.output, TEST_WIDTH, TEST_HEIGHT) == NES_ERR)
+			&& (nes_filter(NES_FILTER_NTSC, NES_FORMAT_ARGB8888, g_test.input_color, g_test.output, TEST_WIDTH, TEST_HEIGHT) == NES_OK))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	for(uint32_t y = 0; y < TEST_HEIGHT; ++y) {
+
+		for(uint32_t x = 0; x < TEST_WIDTH; ++x) {
+
+			for(int output = 0; output < 4; ++output) {
+				uint32_t reference = nes_test_ntsc(x, y, output % 2, output > 1),
+					value = ((uint32_t *)g_test.output)[TEST_INDEX(2, (2 * x) + (output % 2), (2 * y) + (output > 1))];
+
+				for(uint32_t shift = 0; shift < 32; shift += 8) {
+
+					if(ASSERT(abs((int)((value >> shift) & 0xff) - (int)((reference >> shift) & 0xff)) <= TEST_NTSC_TOLERANCE)) {
+						result = NES_ERR;
+						goto exit;
+					}
+				}
+			}
+		}
+	}
+
+	for(uint32_t x = 0; x < TEST_WIDTH; ++x) {
+		g_test.input_color[0][x] = 0x0f;
+		g_test.input_color[1][x] = 0x30;
+		g_test.input_color[2][x] = 0x16;
+		g_test.input_color[3][x] = 0x16 | (0x01 << VIDEO_COLOR_EMPHASIS_SHIFT);
+		g_test.input_color[4][x] = 0x16 | VIDEO_COLOR_GRAYSCALE;
+
+		for(uint32_t y = 5; y < 8; ++y) {
+			g_test.input_color[y][x] = 0x10;
+		}
+	}
+
+	if(ASSERT(nes_filter(NES_FILTER_NTSC, NES_FORMAT_ARGB8888, g_test.input_color, g_test.output, TEST_WIDTH, 8) == NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	for(uint32_t x = 8; x < (2 * (TEST_WIDTH - 4)); ++x) {
+		uint32_t black = ((uint32_t *)g_test.output)[TEST_INDEX(2, x, 0)], white = ((uint32_t *)g_test.output)[TEST_INDEX(2, x, 2)],
+			red = ((uint32_t *)g_test.output)[TEST_INDEX(2, x, 4)], emphasis = ((uint32_t *)g_test.output)[TEST_INDEX(2, x, 6)],
+			grayscale = ((uint32_t *)g_test.output)[TEST_INDEX(2, x, 8)], gray = ((uint32_t *)g_test.output)[TEST_INDEX(2, x, 14)];
+
+		if(ASSERT((black == 0xff000000) && (white == 0xffffffff)
+				&& (((red >> 16) & 0xff) > ((red >> 8) & 0xff)) && (((red >> 16) & 0xff) > (red & 0xff))
+				&& (emphasis != red) && (grayscale == gray))) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_filter_scale(void)
+{
+	int result = NES_OK;
+
+	if(ASSERT((nes_filter_scale(NES_FILTER_NONE) == 1)
+			&& (nes_filter_scale(NES_FILTER_SCALE2X) == 2)
+			&& (nes_filter_scale(NES_FILTER_SCALE3X) == 3)
+			&& (nes_filter_scale(NES_FILTER_HQ2X) == 2)
+			&& (nes_filter_scale(NES_FILTER_NTSC) == 2)
+			&& (nes_filter_scale(NES_FILTER_MAX) == 1))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_filter_scale2x(void)
+{
+	int result = NES_OK;
+
+	nes_test_initialize(3);
+
+	for(int y = 0; y < TEST_HEIGHT; ++y) {
+
+		for(int x = 0; x < TEST_WIDTH; ++x) {
+			uint8_t b = TEST_PIXEL(g_test.input_indexed, x, y - 1), d = TEST_PIXEL(g_test.input_indexed, x - 1, y), e = g_test.input_indexed[y][x],
+				f = TEST_PIXEL(g_test.input_indexed, x + 1, y), h = TEST_PIXEL(g_test.input_indexed, x, y + 1);
+			bool edge = (b != h) && (d != f);
+
+			((uint8_t *)g_test.reference_indexed)[TEST_INDEX(2, 2 * x, 2 * y)] = (edge && (d == b)) ? d : e;
+			((uint8_t *)g_test.reference_indexed)[TEST_INDEX(2, (2 * x) + 1, 2 * y)] = (edge && (b == f)) ? f : e;
+			((uint8_t *)g_test.reference_indexed)[TEST_INDEX(2, 2 * x, (2 * y) + 1)] = (edge && (d == h)) ? d : e;
+			((uint8_t *)g_test.reference_indexed)[TEST_INDEX(2, (2 * x) + 1, (2 * y) + 1)] = (edge && (h == f)) ? f : e;
+		}
+	}
+
+	if(ASSERT((nes_filter(NES_FILTER_SCALE2X, NES_FORMAT_INDEXED8, g_test.input_indexed, g_test.output_indexed, TEST_WIDTH, TEST_HEIGHT) == NES_OK)
+			&& (nes_filter(NES_FILTER_SCALE2X, NES_FORMAT_ARGB8888, g_test.input, g_test.output, TEST_WIDTH, TEST_HEIGHT) == NES_OK))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	for(uint32_t index = 0; index < (TEST_WIDTH * TEST_HEIGHT * 4); ++index) {
+		uint8_t value = ((uint8_t *)g_test.reference_indexed)[index];
+
+		if(ASSERT((((uint8_t *)g_test.output_indexed)[index] == value)
+				&& (((uint32_t *)g_test.output)[index] == (0xff000000 | (value * 0x00402010))))) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_filter_scale3x(void)
+{
+	int result = NES_OK;
+
+	nes_test_initialize(3);
+
+	for(int y = 0; y < TEST_HEIGHT; ++y) {
+
+		for(int x = 0; x < TEST_WIDTH; ++x) {
+			uint8_t a = TEST_PIXEL(g_test.input_indexed, x - 1, y - 1), b = TEST_PIXEL(g_test.input_indexed, x, y - 1),
+				c = TEST_PIXEL(g_test.input_indexed, x + 1, y - 1), d = TEST_PIXEL(g_test.input_indexed, x - 1, y), e = g_test.input_indexed[y][x],
+				f = TEST_PIXEL(g_test.input_indexed, x + 1, y), g = TEST_PIXEL(g_test.input_indexed, x - 1, y + 1),
+				h = TEST_PIXEL(g_test.input_indexed, x, y + 1), i = TEST_PIXEL(g_test.input_indexed, x + 1, y + 1);
+			uint8_t value[9] = { e, e, e, e, e, e, e, e, e };
+
+			if((b != h) && (d != f)) {
+				value[0] = (d == b) ? d : e;
+				value[1] = (((d == b) && (e != c)) || ((b == f) && (e != a))) ? b : e;
+				value[2] = (b == f) ? f : e;
+				value[3] = (((d == b) && (e != g)) || ((d == h) && (e != a))) ? d : e;
+				value[5] = (((b == f) && (e != i)) || ((h == f) && (e != c))) ? f : e;
+				value[6] = (d == h) ? d : e;
+				value[7] = (((d == h) && (e != i)) || ((h == f) && (e != g))) ? h : e;
+				value[8] = (h == f) ? f : e;
+			}
+
+			for(int row = 0; row < 3; ++row) {
+
+				for(int column = 0; column < 3; ++column) {
+					((uint8_t *)g_test.reference_indexed)[TEST_INDEX(3, (3 * x) + column, (3 * y) + row)] = value[(row * 3) + column];
+				}
+			}
+		}
+	}
+
+	if(ASSERT((nes_filter(NES_FILTER_SCALE3X, NES_FORMAT_INDEXED8, g_test.input_indexed, g_test.output_indexed, TEST_WIDTH, TEST_HEIGHT) == NES_OK)
+			&& (nes_filter(NES_FILTER_SCALE3X, NES_FORMAT_ARGB8888, g_test.input, g_test.output, TEST_WIDTH, TEST_HEIGHT) == NES_OK))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	for(uint32_t index = 0; index < (TEST_WIDTH * TEST_HEIGHT * 9); ++index) {
+		uint8_t value = ((uint8_t *)g_test.reference_indexed)[index];
+
+		if(ASSERT((((uint8_t *)g_test.output_indexed)[index] == value)
+				&& (((uint32_t *)g_test.output)[index] == (0xff000000 | (value * 0x00402010))))) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+main(
+	__in int argc,
+	__in char *argv[]
+	)
+{
+	int result = NES_OK, seed;
+
+	if(argc > 1) {
+		seed = strtol(argv[1], NULL, 16);
+	} else {
+		seed = time(NULL);
+	}
+
+	srand(seed);
+	TRACE_SEED(seed);
+
+	for(size_t test = 0; test < TEST_COUNT(TEST); ++test) {
+
+		if(TEST[test]() != NES_OK) {
+			result = NES_ERR;
+		}
+	}
+
+	return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
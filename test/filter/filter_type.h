@@ -0,0 +1,100 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NES_TEST_FILTER_TYPE_H_
+#define NES_TEST_FILTER_TYPE_H_
+
+#include "../../src/common/filter_type.h"
+#include "../common.h"
+
+#define TEST_HEIGHT 240
+#define TEST_NTSC_TOLERANCE 2
+#define TEST_WIDTH 250
+
+#define TEST_INDEX(_SCALE_, _X_, _Y_) \
+	(((_Y_) * TEST_WIDTH * (_SCALE_)) + (_X_))
+
+#define TEST_PIXEL(_BUFFER_, _X_, _Y_) \
+	(_BUFFER_)[((_Y_) < 0) ? 0 : (((_Y_) >= TEST_HEIGHT) ? (TEST_HEIGHT - 1) : (_Y_))] \
+		[((_X_) < 0) ? 0 : (((_X_) >= TEST_WIDTH) ? (TEST_WIDTH - 1) : (_X_))]
+
+typedef struct {
+	uint32_t input[TEST_HEIGHT][TEST_WIDTH];
+	uint16_t input_color[TEST_HEIGHT][TEST_WIDTH];
+	uint8_t input_indexed[TEST_HEIGHT][TEST_WIDTH];
+	uint32_t output[TEST_HEIGHT * 3][TEST_WIDTH * 3];
+	uint8_t output_indexed[TEST_HEIGHT * 3][TEST_WIDTH * 3];
+	uint32_t reference[TEST_HEIGHT * 3][TEST_WIDTH * 3];
+	uint8_t reference_indexed[TEST_HEIGHT * 3][TEST_WIDTH * 3];
+} nes_test_filter_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+uint32_t nes_test_blend(
+	__in uint32_t center,
+	__in uint32_t first,
+	__in uint32_t second
+	);
+
+bool nes_test_different(
+	__in uint32_t first,
+	__in uint32_t second
+	);
+
+int nes_test_filter(void);
+
+int nes_test_filter_hq2x(void);
+
+int nes_test_filter_ntsc(void);
+
+int nes_test_filter_scale(void);
+
+int nes_test_filter_scale2x(void);
+
+int nes_test_filter_scale3x(void);
+
+uint32_t nes_test_ntsc(
+	__in uint32_t x,
+	__in uint32_t y,
+	__in int output,
+	__in bool scanline
+	);
+
+void nes_test_initialize(
+	__in uint32_t colors
+	);
+
+static const nes_test TEST[] = {
+	nes_test_filter,
+	nes_test_filter_hq2x,
+	nes_test_filter_ntsc,
+	nes_test_filter_scale,
+	nes_test_filter_scale2x,
+	nes_test_filter_scale3x,
+	};
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NES_TEST_FILTER_TYPE_H_ */
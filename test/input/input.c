@@ -0,0 +1,177 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./input_type.h"
+
+static nes_test_input_t g_test = {};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void
+nes_test_initialize(void)
+{
+	nes_input_reset(&g_test.input);
+}
+
+int
+nes_test_input_read(void)
+{
+	int result = NES_OK;
+
+	nes_test_initialize();
+
+	for(uint8_t controller = 0; controller < NES_CONTROLLER_MAX; ++controller) {
+		g_test.input.state[controller] = rand();
+	}
+
+	nes_input_port_write(&g_test.input, 1);
+	nes_input_port_write(&g_test.input, 0);
+
+	for(uint8_t controller = 0; controller < NES_CONTROLLER_MAX; ++controller) {
+		uint8_t state = g_test.input.state[controller];
+
+		for(uint8_t button = 0; button < NES_BUTTON_MAX; ++button) {
+
+			if(ASSERT(nes_input_port_read(&g_test.input, controller) == (INPUT_OPEN_BUS | ((state >> button) & 1)))) {
+				result = NES_ERR;
+				goto exit;
+			}
+		}
+
+		if(ASSERT(nes_input_port_read(&g_test.input, controller) == (INPUT_OPEN_BUS | 1))) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+	g_test.input.state[NES_CONTROLLER_1] = 0;
+
+	if(ASSERT(nes_input_port_read(&g_test.input, NES_CONTROLLER_1) == (INPUT_OPEN_BUS | 1))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_input_reset(void)
+{
+	int result = NES_OK;
+
+	g_test.input.state[NES_CONTROLLER_1] = rand();
+	g_test.input.strobe = true;
+	nes_test_initialize();
+
+	for(uint8_t controller = 0; controller < NES_CONTROLLER_MAX; ++controller) {
+
+		if(ASSERT(!g_test.input.shift[controller] && !g_test.input.state[controller])) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+	if(ASSERT(!g_test.input.strobe)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_input_strobe(void)
+{
+	int result = NES_OK;
+
+	nes_test_initialize();
+	g_test.input.state[NES_CONTROLLER_1] = (1 << NES_BUTTON_A) | (1 << NES_BUTTON_START);
+	nes_input_port_write(&g_test.input, 1);
+
+	for(uint8_t read = 0; read < NES_BUTTON_MAX; ++read) {
+
+		if(ASSERT(g_test.input.strobe && (nes_input_port_read(&g_test.input, NES_CONTROLLER_1) == (INPUT_OPEN_BUS | 1)))) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+	g_test.input.state[NES_CONTROLLER_1] = (1 << NES_BUTTON_B);
+
+	if(ASSERT(nes_input_port_read(&g_test.input, NES_CONTROLLER_1) == INPUT_OPEN_BUS)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_input_port_write(&g_test.input, 0);
+	g_test.input.state[NES_CONTROLLER_1] = 0;
+
+	if(ASSERT(!g_test.input.strobe
+			&& (nes_input_port_read(&g_test.input, NES_CONTROLLER_1) == INPUT_OPEN_BUS)
+			&& (nes_input_port_read(&g_test.input, NES_CONTROLLER_1) == (INPUT_OPEN_BUS | 1)))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+main(
+	__in int argc,
+	__in char *argv[]
+	)
+{
+	int result = NES_OK, seed;
+
+	if(argc > 1) {
+		seed = strtol(argv[1], NULL, 16);
+	} else {
+		seed = time(NULL);
+	}
+
+	srand(seed);
+	TRACE_SEED(seed);
+
+	for(size_t test = 0; test < TEST_COUNT(TEST); ++test) {
+
+		if(TEST[test]() != NES_OK) {
+			result = NES_ERR;
+		}
+	}
+
+	return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,271 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./movie_type.h"
+
+static nes_test_movie_t g_test = {};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+int
+nes_test_movie_frame(void)
+{
+	int result = NES_OK;
+	uint8_t state[NES_CONTROLLER_MAX];
+
+	nes_test_initialize();
+
+	if(ASSERT(nes_movie_load(&g_test.configuration, &g_test.movie) == NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	for(uint32_t frame = 0; frame < MOVIE_FRAMES; ++frame) {
+
+		for(uint8_t controller = 0; controller < NES_CONTROLLER_MAX; ++controller) {
+			g_test.state[frame][controller] = state[controller] = rand();
+		}
+
+		if(ASSERT((nes_movie_frame(&g_test.movie, state) == NES_OK)
+				&& !memcmp(state, g_test.state[frame], sizeof(state))
+				&& !g_test.movie.frame)) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_movie_hash(void)
+{
+	int result = NES_OK;
+	uint8_t hash[MOVIE_HASH_WIDTH];
+
+	for(size_t index = 0; index < TEST_COUNT(MOVIE_HASH); ++index) {
+		nes_buffer_t data = { (uint8_t *)MOVIE_HASH[index].input, strlen(MOVIE_HASH[index].input) };
+
+		nes_movie_hash(&data, hash);
+
+		if(ASSERT(!memcmp(hash, MOVIE_HASH[index].hash, sizeof(hash)))) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_movie_load(void)
+{
+	int result = NES_OK;
+
+	nes_test_initialize();
+	g_test.configuration.replay.mode = NES_REPLAY_MAX;
+
+	if(ASSERT(nes_movie_load(&g_test.configuration, &g_test.movie) != NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	g_test.configuration.replay.mode = NES_REPLAY_PLAYBACK;
+	g_test.configuration.replay.path = NULL;
+
+	if(ASSERT(nes_movie_load(&g_test.configuration, &g_test.movie) != NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	g_test.configuration.replay.mode = NES_REPLAY_RECORD;
+	g_test.configuration.replay.path = MOVIE_PATH;
+
+	if(ASSERT((nes_movie_load(&g_test.configuration, &g_test.movie) == NES_OK)
+			&& (g_test.movie.mode == NES_REPLAY_RECORD))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_movie_unload(&g_test.movie);
+	g_test.configuration.replay.mode = NES_REPLAY_PLAYBACK;
+	++g_test.rom[rand() % sizeof(g_test.rom)];
+
+	if(ASSERT(nes_movie_load(&g_test.configuration, &g_test.movie) != NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	remove(MOVIE_PATH);
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_movie_playback(void)
+{
+	long length;
+	FILE *file = NULL;
+	int result = NES_OK;
+	uint8_t state[NES_CONTROLLER_MAX];
+
+	nes_test_initialize();
+	g_test.configuration.replay.mode = NES_REPLAY_RECORD;
+	g_test.configuration.replay.path = MOVIE_PATH;
+
+	for(uint32_t frame = 0; frame < MOVIE_FRAMES; ++frame) {
+
+		if(!frame || !(rand() % 16)) {
+
+			for(uint8_t controller = 0; controller < NES_CONTROLLER_MAX; ++controller) {
+				state[controller] = rand();
+			}
+		}
+
+		memcpy(g_test.state[frame], state, sizeof(state));
+	}
+
+	if(ASSERT(nes_movie_load(&g_test.configuration, &g_test.movie) == NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	for(uint32_t frame = 0; frame < MOVIE_FRAMES; ++frame) {
+		memcpy(state, g_test.state[frame], sizeof(state));
+
+		if(ASSERT(nes_movie_frame(&g_test.movie, state) == NES_OK)) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+	nes_movie_unload(&g_test.movie);
+
+	if(ASSERT((file = fopen(MOVIE_PATH, "rb")) != NULL)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	fseek(file, 0, SEEK_END);
+	length = ftell(file);
+
+	if(ASSERT((length > sizeof(nes_movie_header_t)) && (length < (sizeof(nes_movie_header_t) + sizeof(g_test.state))))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	g_test.configuration.replay.mode = NES_REPLAY_PLAYBACK;
+
+	if(ASSERT(nes_movie_load(&g_test.configuration, &g_test.movie) == NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	for(uint32_t frame = 0; frame < MOVIE_FRAMES; ++frame) {
+		memset(state, 0, sizeof(state));
+
+		if(ASSERT((nes_movie_frame(&g_test.movie, state) == NES_OK)
+				&& !memcmp(state, g_test.state[frame], sizeof(state)))) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+	if(ASSERT((nes_movie_frame(&g_test.movie, state) == NES_EVT)
+			&& (g_test.movie.frame == MOVIE_FRAMES))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+
+	if(file) {
+		fclose(file);
+	}
+
+	remove(MOVIE_PATH);
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+void
+nes_test_initialize(void)
+{
+	nes_test_uninitialize();
+
+	for(size_t index = 0; index < sizeof(g_test.rom); ++index) {
+		g_test.rom[index] = rand();
+	}
+
+	g_test.configuration.rom.data.ptr = g_test.rom;
+	g_test.configuration.rom.data.length = sizeof(g_test.rom);
+}
+
+void
+nes_test_uninitialize(void)
+{
+	nes_movie_unload(&g_test.movie);
+	memset(&g_test, 0, sizeof(g_test));
+}
+
+int
+main(
+	__in int argc,
+	__in char *argv[]
+	)
+{
+	int result = NES_OK, seed;
+
+	if(argc > 1) {
+		seed = strtol(argv[1], NULL, 16);
+	} else {
+		seed = time(NULL);
+	}
+
+	srand(seed);
+	TRACE_SEED(seed);
+
+	for(size_t test = 0; test < TEST_COUNT(TEST); ++test) {
+
+		if(TEST[test]() != NES_OK) {
+			result = NES_ERR;
+		}
+	}
+
+	nes_test_uninitialize();
+
+	return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,75 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NES_TEST_MOVIE_TYPE_H_
+#define NES_TEST_MOVIE_TYPE_H_
+
+#include "../../src/common/movie_type.h"
+#include "../common.h"
+
+#define MOVIE_FRAMES 1024
+#define MOVIE_PATH "test-movie.nesm"
+
+typedef struct {
+	nes_t configuration;
+	nes_movie_t movie;
+	uint8_t rom[BYTES_PER_KBYTE];
+	uint8_t state[MOVIE_FRAMES][NES_CONTROLLER_MAX];
+} nes_test_movie_t;
+
+static const struct {
+	const char *input;
+	uint8_t hash[MOVIE_HASH_WIDTH];
+} MOVIE_HASH[] = {
+	{ "", { 0xda, 0x39, 0xa3, 0xee, 0x5e, 0x6b, 0x4b, 0x0d, 0x32, 0x55, 0xbf, 0xef, 0x95, 0x60, 0x18, 0x90, 0xaf, 0xd8, 0x07, 0x09, }, },
+	{ "abc", { 0xa9, 0x99, 0x3e, 0x36, 0x47, 0x06, 0x81, 0x6a, 0xba, 0x3e, 0x25, 0x71, 0x78, 0x50, 0xc2, 0x6c, 0x9c, 0xd0, 0xd8, 0x9d, }, },
+	{ "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+		{ 0x84, 0x98, 0x3e, 0x44, 0x1c, 0x3b, 0xd2, 0x6e, 0xba, 0xae, 0x4a, 0xa1, 0xf9, 0x51, 0x29, 0xe5, 0xe5, 0x46, 0x70, 0xf1, }, },
+	};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+int nes_test_movie_frame(void);
+
+int nes_test_movie_hash(void);
+
+int nes_test_movie_load(void);
+
+int nes_test_movie_playback(void);
+
+void nes_test_initialize(void);
+
+void nes_test_uninitialize(void);
+
+static const nes_test TEST[] = {
+	nes_test_movie_frame,
+	nes_test_movie_hash,
+	nes_test_movie_load,
+	nes_test_movie_playback,
+	};
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NES_TEST_MOVIE_TYPE_H_ */
@@ -0,0 +1,211 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./palette_type.h"
+
+static nes_test_palette_t g_test = {};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+int
+nes_test_palette_custom(void)
+{
+	int result = NES_OK;
+	nes_buffer_t data = { .ptr = g_test.data, .length = sizeof(g_test.data) };
+
+	nes_test_initialize();
+
+	if(ASSERT(nes_palette_load(&g_test.palette, &data) == NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	for(uint16_t index = 0; index < VIDEO_COLOR_GRAYSCALE; ++index) {
+		const nes_color_t *color = &g_test.palette.color[index];
+		const uint8_t *channel = &g_test.data[index * PALETTE_CHANNELS];
+
+		if(ASSERT((color->red == channel[0])
+				&& (color->green == channel[1])
+				&& (color->blue == channel[2])
+				&& (color->alpha == UINT8_MAX)
+				&& (g_test.palette.color[VIDEO_COLOR_GRAYSCALE | index].raw
+					== g_test.palette.color[index & (VIDEO_COLOR_EMPHASIS | 0x30)].raw))) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+	data.length = VIDEO_COLOR_PALETTE * PALETTE_CHANNELS;
+
+	if(ASSERT(nes_palette_load(&g_test.palette, &data) == NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	for(uint16_t index = VIDEO_COLOR_PALETTE; index < VIDEO_COLOR_GRAYSCALE; ++index) {
+		const nes_color_t *base = &g_test.palette.color[index % VIDEO_COLOR_PALETTE], *color = &g_test.palette.color[index];
+		nes_color_t expected = *base;
+
+		/* Each emphasis bit darkens the other two channels, so emphasis 7 darkens all three twice */
+		if((index & 0x0f) < 0x0e) {
+
+			switch(index >> VIDEO_COLOR_EMPHASIS_SHIFT) {
+				case 1:
+					expected.green *= PALETTE_ATTENUATION_SCALE[1];
+					expected.blue *= PALETTE_ATTENUATION_SCALE[1];
+					break;
+				case 2:
+					expected.red *= PALETTE_ATTENUATION_SCALE[1];
+					expected.blue *= PALETTE_ATTENUATION_SCALE[1];
+					break;
+				case 3:
+					expected.red *= PALETTE_ATTENUATION_SCALE[1];
+					expected.green *= PALETTE_ATTENUATION_SCALE[1];
+					expected.blue *= PALETTE_ATTENUATION_SCALE[2];
+					break;
+				case 4:
+					expected.red *= PALETTE_ATTENUATION_SCALE[1];
+					expected.green *= PALETTE_ATTENUATION_SCALE[1];
+					break;
+				case 5:
+					expected.red *= PALETTE_ATTENUATION_SCALE[1];
+					expected.green *= PALETTE_ATTENUATION_SCALE[2];
+					expected.blue *= PALETTE_ATTENUATION_SCALE[1];
+					break;
+				case 6:
+					expected.red *= PALETTE_ATTENUATION_SCALE[2];
+					expected.green *= PALETTE_ATTENUATION_SCALE[1];
+					expected.blue *= PALETTE_ATTENUATION_SCALE[1];
+					break;
+				case 7:
+					expected.red *= PALETTE_ATTENUATION_SCALE[2];
+					expected.green *= PALETTE_ATTENUATION_SCALE[2];
+					expected.blue *= PALETTE_ATTENUATION_SCALE[2];
+					break;
+				default:
+					break;
+			}
+		}
+
+		if(ASSERT(color->raw == expected.raw)) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_palette_default(void)
+{
+	int result = NES_OK;
+	nes_buffer_t data = {};
+
+	nes_test_initialize();
+
+	if(ASSERT((nes_palette_load(&g_test.palette, &data) == NES_OK)
+			&& !memcmp(g_test.palette.color, PALETTE, sizeof(PALETTE))
+			&& (g_test.palette.color[VIDEO_COLOR_EMPHASIS | 0x0f].raw == PALETTE[0x0f].raw))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	for(uint16_t index = 0; index < VIDEO_COLOR_MAX; ++index) {
+		const nes_color_t *color = &g_test.palette.color[index];
+
+		if(ASSERT((g_test.palette.indexed[index] == (index & ((index & VIDEO_COLOR_GRAYSCALE) ? 0x30 : (VIDEO_COLOR_PALETTE - 1))))
+				&& (g_test.palette.rgb565[index] == (((color->red >> 3) << 11) | ((color->green >> 2) << 5) | (color->blue >> 3))))) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_palette_length(void)
+{
+	int result = NES_OK;
+	nes_buffer_t data = { .ptr = g_test.data, .length = (VIDEO_COLOR_PALETTE * PALETTE_CHANNELS) - 1 };
+
+	nes_test_initialize();
+
+	if(ASSERT(nes_palette_load(&g_test.palette, &data) == NES_ERR)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+void
+nes_test_initialize(void)
+{
+	memset(&g_test.palette, 0, sizeof(g_test.palette));
+
+	for(size_t index = 0; index < sizeof(g_test.data); ++index) {
+		g_test.data[index] = rand();
+	}
+}
+
+int
+main(
+	__in int argc,
+	__in char *argv[]
+	)
+{
+	int result = NES_OK, seed;
+
+	if(argc > 1) {
+		seed = strtol(argv[1], NULL, 16);
+	} else {
+		seed = time(NULL);
+	}
+
+	srand(seed);
+	TRACE_SEED(seed);
+
+	for(size_t test = 0; test < TEST_COUNT(TEST); ++test) {
+
+		if(TEST[test]() != NES_OK) {
+			result = NES_ERR;
+		}
+	}
+
+	return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -7522,6 +7522,49 @@ exit:
 	return result;
 }
 
+int
+nes_test_processor_interrupt_clear(void)
+{
+	int result = NES_OK;
+
+	for(size_t trial = 0; trial < TRIALS; ++trial) {
+		nes_register_t address = { .word = (rand() % 0x8000) + 512 };
+
+		nes_test_initialize();
+		nes_processor_write_word(&g_test.processor, MASKABLE_ADDRESS, address.word + 256);
+		nes_processor_write_word(&g_test.processor, RESET_ADDRESS, address.word);
+		nes_processor_reset(&g_test.processor);
+		nes_processor_interrupt(&g_test.processor, true);
+
+		while(g_test.processor.cycles > 0) {
+			nes_processor_step(&g_test.processor);
+		}
+
+		nes_processor_step(&g_test.processor);
+		nes_processor_interrupt_clear(&g_test.processor);
+		g_test.processor.status.interrupt_disabled = false;
+
+		while(g_test.processor.cycles > 0) {
+			nes_processor_step(&g_test.processor);
+		}
+
+		nes_processor_step(&g_test.processor);
+
+		if(ASSERT((g_test.processor.cycles == 1)
+				&& (g_test.processor.program_counter.word == ((address.word + 2) & UINT16_MAX))
+				&& (g_test.processor.stack_pointer.low == 0xfd)
+				&& (g_test.processor.pending.maskable == false))) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
 int
 nes_test_processor_interrupt_maskable(void)
 {
@@ -7581,12 +7624,45 @@ nes_test_processor_interrupt_maskable(void)
 				&& (g_test.processor.accumulator.low == 0)
 				&& (g_test.processor.index_x.low == 0)
 				&& (g_test.processor.index_y.low == 0)
-				&& (g_test.processor.pending.maskable == false)
+				&& (g_test.processor.pending.maskable == true)
 				&& (nes_processor_pull(&g_test.processor) == 0x20)
 				&& (nes_processor_pull_word(&g_test.processor) == ((address.word + 1) & UINT16_MAX)))) {
 			result = NES_ERR;
 			goto exit;
 		}
+
+		g_test.processor.status.interrupt_disabled = false;
+
+		while(g_test.processor.cycles > 0) {
+			nes_processor_step(&g_test.processor);
+		}
+
+		nes_processor_step(&g_test.processor);
+
+		if(ASSERT((g_test.processor.cycles == MASKABLE_CYCLES - 1)
+				&& (g_test.processor.program_counter.word == ((address.word + 256) & UINT16_MAX))
+				&& (g_test.processor.stack_pointer.low == 0xfd - 3)
+				&& (g_test.processor.pending.maskable == true))) {
+			result = NES_ERR;
+			goto exit;
+		}
+
+		nes_processor_interrupt_clear(&g_test.processor);
+		g_test.processor.status.interrupt_disabled = false;
+
+		while(g_test.processor.cycles > 0) {
+			nes_processor_step(&g_test.processor);
+		}
+
+		nes_processor_step(&g_test.processor);
+
+		if(ASSERT((g_test.processor.cycles == 1)
+				&& (g_test.processor.program_counter.word == ((address.word + 257) & UINT16_MAX))
+				&& (g_test.processor.stack_pointer.low == 0xfd - 3)
+				&& (g_test.processor.pending.maskable == false))) {
+			result = NES_ERR;
+			goto exit;
+		}
 	}
 
 exit:
@@ -121,6 +121,8 @@ int nes_test_processor_fetch_zeropage_x(void);
 
 int nes_test_processor_fetch_zeropage_y(void);
 
+int nes_test_processor_interrupt_clear(void);
+
 int nes_test_processor_interrupt_maskable(void);
 
 int nes_test_processor_interrupt_non_maskable(void);
@@ -165,6 +167,7 @@ static const nes_test TEST[] = {
         nes_test_processor_fetch_zeropage,
         nes_test_processor_fetch_zeropage_x,
         nes_test_processor_fetch_zeropage_y,
+        nes_test_processor_interrupt_clear,
         nes_test_processor_interrupt_maskable,
         nes_test_processor_interrupt_non_maskable,
 	nes_test_processor_reset,
@@ -0,0 +1,297 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./rewind_type.h"
+
+static nes_test_rewind_t g_test = {};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+int
+nes_test_rewind_capacity(void)
+{
+	int result = NES_OK;
+	size_t capacity = 4 * BYTES_PER_KBYTE, frame = 0;
+
+	nes_test_initialize();
+
+	if(ASSERT(nes_rewind_load(&g_test.rewind, (nes_buffer_t []){ { g_test.region_0, TEST_REGION_0_WIDTH },
+			{ g_test.region_1, TEST_REGION_1_WIDTH } }, TEST_REGION_MAX, capacity) == NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	for(; frame < (TEST_FRAME_MAX - 1); ++frame) {
+		nes_test_rewind_frame(frame + 1, PAGE_WIDTH);
+
+		if(ASSERT(g_test.rewind.length <= capacity)) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+	if(ASSERT(g_test.rewind.count && (g_test.rewind.count < frame))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	while(g_test.rewind.count) {
+		nes_rewind_pop(&g_test.rewind);
+		nes_rewind_restore(&g_test.rewind);
+
+		if(ASSERT(nes_test_rewind_match(--frame))) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+	if(ASSERT((nes_rewind_pop(&g_test.rewind) == NES_EVT)
+			&& !g_test.rewind.length)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_rewind_dirty(void)
+{
+	size_t length;
+	int result = NES_OK;
+
+	nes_test_initialize();
+
+	if(ASSERT(nes_rewind_load(&g_test.rewind, (nes_buffer_t []){ { g_test.region_0, TEST_REGION_0_WIDTH },
+			{ g_test.region_1, TEST_REGION_1_WIDTH } }, TEST_REGION_MAX, BYTES_PER_MBYTE) == NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	++g_test.region_0[0];
+	++g_test.region_1[PAGE_WIDTH];
+	nes_rewind_push(&g_test.rewind);
+
+	if(ASSERT((g_test.rewind.count == 1)
+			&& (g_test.rewind.length == (2 * REWIND_RECORD_HEADER)))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	length = g_test.rewind.length;
+	nes_rewind_dirty(&g_test.rewind, TEST_REGION_1, TEST_REGION_1_WIDTH);
+
+	if(ASSERT(!g_test.rewind.dirty.ptr[g_test.rewind.page[TEST_REGION_MAX] - 1])) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_rewind_dirty(&g_test.rewind, TEST_REGION_0, 0);
+	nes_rewind_invalidate(&g_test.rewind, TEST_REGION_1);
+	nes_rewind_push(&g_test.rewind);
+
+	if(ASSERT((g_test.rewind.count == 2)
+			&& ((g_test.rewind.length - length) == ((2 * REWIND_RECORD_HEADER) + (2 * (REWIND_PAGE_HEADER + 2)))))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+void
+nes_test_rewind_frame(
+	__in size_t frame,
+	__in size_t count
+	)
+{
+
+	for(size_t index = 0; index < count; ++index) {
+		size_t offset = rand() % (TEST_REGION_0_WIDTH + TEST_REGION_1_WIDTH);
+
+		if(offset < TEST_REGION_0_WIDTH) {
+			g_test.region_0[offset] = rand();
+			nes_rewind_dirty(&g_test.rewind, TEST_REGION_0, offset);
+		} else {
+			g_test.region_1[offset - TEST_REGION_0_WIDTH] = rand();
+			nes_rewind_dirty(&g_test.rewind, TEST_REGION_1, offset - TEST_REGION_0_WIDTH);
+		}
+	}
+
+	nes_rewind_push(&g_test.rewind);
+	memcpy(g_test.frame[frame], g_test.region_0, TEST_REGION_0_WIDTH);
+	memcpy(g_test.frame[frame] + TEST_REGION_0_WIDTH, g_test.region_1, TEST_REGION_1_WIDTH);
+}
+
+int
+nes_test_rewind_load(void)
+{
+	int result = NES_OK;
+	nes_buffer_t region[] = { { g_test.region_0, TEST_REGION_0_WIDTH }, { g_test.region_1, TEST_REGION_1_WIDTH } };
+
+	nes_test_initialize();
+
+	if(ASSERT((nes_rewind_load(&g_test.rewind, region, TEST_REGION_MAX, 0) == NES_ERR)
+			&& (nes_rewind_load(&g_test.rewind, region, 0, BYTES_PER_MBYTE) == NES_ERR)
+			&& (nes_rewind_load(&g_test.rewind, region, REWIND_REGION_MAX + 1, BYTES_PER_MBYTE) == NES_ERR))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_test_initialize();
+
+	if(ASSERT((nes_rewind_load(&g_test.rewind, region, TEST_REGION_MAX, BYTES_PER_MBYTE) == NES_OK)
+			&& (g_test.rewind.page[TEST_REGION_1] == (TEST_REGION_0_WIDTH / PAGE_WIDTH))
+			&& (g_test.rewind.page[TEST_REGION_MAX] == ((TEST_REGION_0_WIDTH / PAGE_WIDTH) + 2))
+			&& (g_test.rewind.data.length == BYTES_PER_MBYTE)
+			&& !g_test.rewind.count
+			&& !memcmp(nes_rewind_image(&g_test.rewind, TEST_REGION_0), g_test.region_0, TEST_REGION_0_WIDTH)
+			&& !memcmp(nes_rewind_image(&g_test.rewind, TEST_REGION_1), g_test.region_1, TEST_REGION_1_WIDTH))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+bool
+nes_test_rewind_match(
+	__in size_t frame
+	)
+{
+	return !memcmp(g_test.frame[frame], g_test.region_0, TEST_REGION_0_WIDTH)
+		&& !memcmp(g_test.frame[frame] + TEST_REGION_0_WIDTH, g_test.region_1, TEST_REGION_1_WIDTH);
+}
+
+int
+nes_test_rewind_pop(void)
+{
+	int result = NES_OK;
+	size_t frame = TEST_FRAME_MAX - 1;
+
+	nes_test_initialize();
+
+	if(ASSERT((nes_rewind_load(&g_test.rewind, (nes_buffer_t []){ { g_test.region_0, TEST_REGION_0_WIDTH },
+			{ g_test.region_1, TEST_REGION_1_WIDTH } }, TEST_REGION_MAX, BYTES_PER_MBYTE) == NES_OK)
+			&& (nes_rewind_pop(&g_test.rewind) == NES_EVT))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	for(size_t index = 1; index <= frame; ++index) {
+		nes_test_rewind_frame(index, rand() % PAGE_WIDTH);
+	}
+
+	for(; frame; --frame) {
+
+		if(ASSERT(nes_rewind_pop(&g_test.rewind) == NES_OK)) {
+			result = NES_ERR;
+			goto exit;
+		}
+
+		nes_rewind_restore(&g_test.rewind);
+
+		if(ASSERT(nes_test_rewind_match(frame - 1))) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+	if(ASSERT((nes_rewind_pop(&g_test.rewind) == NES_EVT)
+			&& !g_test.rewind.length
+			&& (g_test.rewind.head == g_test.rewind.tail))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+void
+nes_test_initialize(void)
+{
+	nes_test_uninitialize();
+
+	for(size_t index = 0; index < TEST_REGION_0_WIDTH; ++index) {
+		g_test.region_0[index] = rand();
+	}
+
+	for(size_t index = 0; index < TEST_REGION_1_WIDTH; ++index) {
+		g_test.region_1[index] = rand();
+	}
+
+	memcpy(g_test.frame[0], g_test.region_0, TEST_REGION_0_WIDTH);
+	memcpy(g_test.frame[0] + TEST_REGION_0_WIDTH, g_test.region_1, TEST_REGION_1_WIDTH);
+}
+
+void
+nes_test_uninitialize(void)
+{
+	nes_rewind_unload(&g_test.rewind);
+	memset(&g_test, 0, sizeof(g_test));
+}
+
+int
+main(
+	__in int argc,
+	__in char *argv[]
+	)
+{
+	int result = NES_OK, seed;
+
+	if(argc > 1) {
+		seed = strtol(argv[1], NULL, 16);
+	} else {
+		seed = time(NULL);
+	}
+
+	srand(seed);
+	TRACE_SEED(seed);
+
+	for(size_t test = 0; test < TEST_COUNT(TEST); ++test) {
+
+		if(TEST[test]() != NES_OK) {
+			result = NES_ERR;
+		}
+	}
+
+	nes_test_uninitialize();
+
+	return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,82 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NES_TEST_REWIND_TYPE_H_
+#define NES_TEST_REWIND_TYPE_H_
+
+#include "../../src/common/rewind_type.h"
+#include "../common.h"
+
+#define TEST_FRAME_MAX 64
+
+#define TEST_REGION_0_WIDTH 0x0800
+#define TEST_REGION_1_WIDTH 0x0123
+
+enum {
+	TEST_REGION_0 = 0,
+	TEST_REGION_1,
+	TEST_REGION_MAX,
+};
+
+typedef struct {
+	uint8_t frame[TEST_FRAME_MAX][TEST_REGION_0_WIDTH + TEST_REGION_1_WIDTH];
+	uint8_t region_0[TEST_REGION_0_WIDTH];
+	uint8_t region_1[TEST_REGION_1_WIDTH];
+	nes_rewind_t rewind;
+} nes_test_rewind_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+int nes_test_rewind_capacity(void);
+
+int nes_test_rewind_dirty(void);
+
+void nes_test_rewind_frame(
+	__in size_t frame,
+	__in size_t count
+	);
+
+int nes_test_rewind_load(void);
+
+bool nes_test_rewind_match(
+	__in size_t frame
+	);
+
+int nes_test_rewind_pop(void);
+
+void nes_test_initialize(void);
+
+void nes_test_uninitialize(void);
+
+static const nes_test TEST[] = {
+	nes_test_rewind_capacity,
+	nes_test_rewind_dirty,
+	nes_test_rewind_load,
+	nes_test_rewind_pop,
+	};
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NES_TEST_REWIND_TYPE_H_ */
@@ -27,6 +27,14 @@ static nes_test_video_t g_test = {};
 extern "C" {
 #endif /* __cplusplus */
 
+void
+nes_bus_interrupt(
+	__in bool maskable
+	)
+{
+	g_test.interrupt = !maskable;
+}
+
 uint8_t
 nes_bus_read(
 	__in int bus,
@@ -69,14 +77,231 @@ nes_bus_write(
 	}
 }
 
+void
+nes_service_pixel(
+	__in uint16_t color,
+	__in uint32_t x,
+	__in uint32_t y
+	)
+{
+	g_test.frame[y][x] = color;
+	++g_test.pixel;
+}
+
 void
 nes_test_initialize(void)
 {
+	g_test.interrupt = false;
+	g_test.pixel = 0;
 	memset(g_test.memory.ptr, 0x00, g_test.memory.length);
 	memset(g_test.object.ptr, 0x00, g_test.object.length);
 	nes_video_reset(&g_test.video);
 }
 
+int
+nes_test_video_band(void)
+{
+	int result = NES_OK;
+	nes_video_status_t status;
+	uint8_t scroll = rand();
+	uint16_t frame[VIDEO_HEIGHT][VIDEO_WIDTH];
+
+	nes_test_initialize();
+
+	for(uint32_t address = 0; address < VIDEO_PALETTE_RAM_BEGIN; ++address) {
+		g_test.memory.ptr[address] = rand();
+	}
+
+	for(uint32_t address = VIDEO_PALETTE_RAM_BEGIN; address < VIDEO_ADDRESS_MIRROR; ++address) {
+		g_test.memory.ptr[address] = rand() % 0x40;
+	}
+
+	for(uint32_t address = 0; address < g_test.object.length; ++address) {
+		g_test.object.ptr[address] = rand();
+	}
+
+	nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, 0x1e);
+	nes_video_synchronize(&g_test.video, ((VIDEO_HEIGHT / 2) * VIDEO_DOTS) / VIDEO_CYCLES);
+	nes_video_port_write(&g_test.video, VIDEO_PORT_SCROLL, scroll);
+	nes_video_port_write(&g_test.video, VIDEO_PORT_SCROLL, scroll);
+	nes_video_step(&g_test.video, g_test.video.event);
+	memcpy(frame, g_test.frame, sizeof(frame));
+	status.raw = g_test.video.status.raw;
+	nes_video_reset(&g_test.video);
+	memset(g_test.frame, 0, sizeof(g_test.frame));
+	g_test.pixel = 0;
+
+	if(ASSERT((nes_video_band_load(&g_test.video, 0) != NES_OK)
+			&& (nes_video_band_load(&g_test.video, VIDEO_BAND_MAX + 1) != NES_OK)
+			&& (nes_video_band_load(&g_test.video, 4) == NES_OK))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, 0x1e);
+	nes_video_synchronize(&g_test.video, ((VIDEO_HEIGHT / 2) * VIDEO_DOTS) / VIDEO_CYCLES);
+	nes_video_port_write(&g_test.video, VIDEO_PORT_SCROLL, scroll);
+	nes_video_port_write(&g_test.video, VIDEO_PORT_SCROLL, scroll);
+
+	if(ASSERT(nes_video_step(&g_test.video, g_test.video.event)
+			&& (g_test.pixel == (VIDEO_WIDTH * VIDEO_HEIGHT))
+			&& !memcmp(frame, g_test.frame, sizeof(frame))
+			&& (g_test.video.status.raw == status.raw))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_video_band_unload(&g_test.video);
+
+	if(ASSERT(!g_test.video.band)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	nes_video_band_unload(&g_test.video);
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_video_blank(void)
+{
+	int result = NES_OK;
+	uint16_t color, scanline = VIDEO_HEIGHT / 2;
+
+	nes_test_initialize();
+
+	for(uint32_t address = 0; address < VIDEO_ADDRESS_MIRROR; ++address) {
+		g_test.memory.ptr[address] = rand();
+	}
+
+	for(uint32_t address = 0; address < g_test.object.length; ++address) {
+		g_test.object.ptr[address] = rand();
+	}
+
+	color = (g_test.memory.ptr[VIDEO_PALETTE_RAM_BEGIN] & 0x3f) | VIDEO_COLOR_GRAYSCALE | (0x01 << VIDEO_COLOR_EMPHASIS_SHIFT);
+	nes_video_port_write(&g_test.video, VIDEO_PORT_CONTROL, 0x80);
+	nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, 0x21);
+
+	if(ASSERT(nes_video_step(&g_test.video, g_test.video.event)
+			&& g_test.interrupt
+			&& g_test.video.status.vblank
+			&& !g_test.video.status.sprite_0_hit
+			&& !g_test.video.status.sprite_overflow
+			&& (g_test.video.scanline == VIDEO_SCANLINE_VBLANK)
+			&& (g_test.video.dot == 1)
+			&& (g_test.pixel == (VIDEO_WIDTH * VIDEO_HEIGHT))
+			&& (g_test.video.blank == VIDEO_HEIGHT))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	for(uint16_t y = 0; y < VIDEO_HEIGHT; ++y) {
+
+		for(uint16_t x = 0; x < VIDEO_WIDTH; ++x) {
+
+			if(ASSERT(g_test.frame[y][x] == color)) {
+				result = NES_ERR;
+				goto exit;
+			}
+		}
+	}
+
+	g_test.interrupt = false;
+	nes_video_synchronize(&g_test.video, (VIDEO_SCANLINES * VIDEO_DOTS) / VIDEO_CYCLES);
+	nes_video_synchronize(&g_test.video, (((VIDEO_SCANLINES + scanline) * VIDEO_DOTS) / VIDEO_CYCLES) + 1);
+	nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, 0x1e);
+
+	if(ASSERT(nes_video_step(&g_test.video, g_test.video.event)
+			&& g_test.interrupt
+			&& (g_test.video.blank == (VIDEO_HEIGHT + scanline)))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_video_pipeline(void)
+{
+	uint64_t cycle;
+	int result = NES_OK;
+	uint8_t data, pattern;
+	nes_video_status_t status;
+	uint16_t frame[VIDEO_HEIGHT][VIDEO_WIDTH];
+
+	nes_test_initialize();
+
+	for(uint32_t address = 0; address < VIDEO_PALETTE_RAM_BEGIN; ++address) {
+		g_test.memory.ptr[address] = rand();
+	}
+
+	for(uint32_t address = VIDEO_PALETTE_RAM_BEGIN; address < VIDEO_ADDRESS_MIRROR; ++address) {
+		g_test.memory.ptr[address] = rand() % 0x40;
+	}
+
+	for(uint32_t address = 0; address < g_test.object.length; ++address) {
+		g_test.object.ptr[address] = rand();
+	}
+
+	data = g_test.memory.ptr[VIDEO_RAM_BEGIN];
+	pattern = g_test.memory.ptr[data * VIDEO_TILE_BYTES];
+	nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, 0x1e);
+	nes_video_write(&g_test.video, data * VIDEO_TILE_BYTES, ~pattern);
+	nes_video_step(&g_test.video, g_test.video.event);
+	memcpy(frame, g_test.frame, sizeof(frame));
+	status.raw = g_test.video.status.raw;
+	nes_video_reset(&g_test.video);
+	g_test.memory.ptr[data * VIDEO_TILE_BYTES] = pattern;
+	memset(g_test.frame, 0, sizeof(g_test.frame));
+	g_test.pixel = 0;
+
+	if(ASSERT(nes_video_pipeline_load(&g_test.video) == NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, 0x1e);
+	nes_video_write(&g_test.video, data * VIDEO_TILE_BYTES, ~pattern);
+	cycle = g_test.video.event;
+
+	if(ASSERT(nes_video_step(&g_test.video, cycle)
+			&& !g_test.pixel
+			&& (g_test.video.status.raw == status.raw))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	cycle = g_test.video.event;
+
+	if(ASSERT(nes_video_step(&g_test.video, cycle)
+			&& (g_test.pixel == (VIDEO_WIDTH * VIDEO_HEIGHT))
+			&& !memcmp(frame, g_test.frame, sizeof(frame))
+			&& (g_test.video.status.raw == status.raw))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_video_pipeline_unload(&g_test.video);
+
+	if(ASSERT(!g_test.video.pipeline)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	nes_video_pipeline_unload(&g_test.video);
+	TRACE_RESULT(result);
+
+	return result;
+}
+
 int
 nes_test_video_port_read(void)
 {
@@ -211,8 +436,11 @@ nes_test_video_port_write(void)
 	nes_test_initialize();
 	data.low = rand();
 	nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, data.low);
+	nes_video_render(&g_test.video, 0);
 
-	if(ASSERT(g_test.video.mask.raw == data.low)) {
+	if(ASSERT((g_test.video.mask.raw == data.low)
+			&& (g_test.video.color == (((data.low >> 5) << VIDEO_COLOR_EMPHASIS_SHIFT) | ((data.low & 1) ? VIDEO_COLOR_GRAYSCALE : 0)))
+			&& ((g_test.frame[0][0] & ~VIDEO_PALETTE_MASK) == g_test.video.color))) {
 		result = NES_ERR;
 		goto exit;
 	}
@@ -322,6 +550,84 @@ exit:
 	return result;
 }
 
+int
+nes_test_video_render(void)
+{
+	int result = NES_OK;
+	uint8_t scroll = rand() | 1;
+	const uint8_t mask[] = { 0x1e, 0x18, };
+
+	for(size_t index = 0; index < TEST_COUNT(mask); ++index) {
+		uint16_t dot, scanline = VIDEO_HEIGHT / 2;
+
+		nes_test_initialize();
+
+		for(uint32_t address = 0; address < VIDEO_PALETTE_RAM_BEGIN; ++address) {
+			g_test.memory.ptr[address] = rand();
+		}
+
+		for(uint32_t address = VIDEO_PALETTE_RAM_BEGIN; address < VIDEO_ADDRESS_MIRROR; ++address) {
+			g_test.memory.ptr[address] = rand() % 0x40;
+		}
+
+		for(uint32_t address = 0; address < g_test.object.length; ++address) {
+			g_test.object.ptr[address] = rand();
+		}
+
+		nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, mask[index]);
+		nes_video_step(&g_test.video, g_test.video.event);
+		memcpy(g_test.frame_tile, g_test.frame, sizeof(g_test.frame));
+		nes_video_reset(&g_test.video);
+		nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, mask[index]);
+		nes_video_port_write(&g_test.video, VIDEO_PORT_SCROLL, scroll);
+		nes_video_port_write(&g_test.video, VIDEO_PORT_SCROLL, scroll);
+		nes_video_step(&g_test.video, g_test.video.event);
+		memcpy(g_test.frame_scroll, g_test.frame, sizeof(g_test.frame));
+		nes_video_reset(&g_test.video);
+		memset(g_test.frame, 0, sizeof(g_test.frame));
+		g_test.pixel = 0;
+		nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, mask[index]);
+
+		for(uint16_t y = 0; y < VIDEO_HEIGHT; ++y) {
+			nes_video_synchronize(&g_test.video, ((y * VIDEO_DOTS) / VIDEO_CYCLES) + 1);
+			nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, mask[index]);
+		}
+
+		if(ASSERT(nes_video_step(&g_test.video, g_test.video.event)
+				&& (g_test.pixel == (VIDEO_WIDTH * VIDEO_HEIGHT))
+				&& !memcmp(g_test.frame, g_test.frame_tile, sizeof(g_test.frame)))) {
+			result = NES_ERR;
+			goto exit;
+		}
+
+		nes_video_reset(&g_test.video);
+		memset(g_test.frame, 0, sizeof(g_test.frame));
+		g_test.pixel = 0;
+		nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, mask[index]);
+		nes_video_synchronize(&g_test.video, ((scanline * VIDEO_DOTS) + (VIDEO_WIDTH / 2)) / VIDEO_CYCLES);
+		dot = g_test.video.dot;
+		nes_video_port_write(&g_test.video, VIDEO_PORT_SCROLL, scroll);
+		nes_video_port_write(&g_test.video, VIDEO_PORT_SCROLL, scroll);
+
+		if(ASSERT(nes_video_step(&g_test.video, g_test.video.event)
+				&& (g_test.pixel == (VIDEO_WIDTH * VIDEO_HEIGHT))
+				&& !g_test.video.span
+				&& !memcmp(g_test.frame, g_test.frame_tile, scanline * sizeof(*g_test.frame))
+				&& !memcmp(g_test.frame[scanline], g_test.frame_tile[scanline], dot * sizeof(**g_test.frame))
+				&& !memcmp(&g_test.frame[scanline][dot], &g_test.frame_scroll[scanline][dot], (VIDEO_WIDTH - dot) * sizeof(**g_test.frame))
+				&& !memcmp(g_test.frame[scanline + 1], g_test.frame_scroll[scanline + 1], (VIDEO_HEIGHT - (scanline + 1)) * sizeof(*g_test.frame))
+				&& memcmp(g_test.frame_scroll, g_test.frame_tile, sizeof(g_test.frame)))) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
 int
 nes_test_video_reset(void)
 {
@@ -331,11 +637,17 @@ nes_test_video_reset(void)
 
 	if(ASSERT(!g_test.video.address.word
 			&& !g_test.video.address_latch
+			&& !g_test.video.blank
+			&& !g_test.video.complete
 			&& !g_test.video.control.raw
-			&& !g_test.video.cycles
+			&& !g_test.video.cycle
 			&& !g_test.video.data.word
+			&& !g_test.video.dot
+			&& g_test.video.event
+			&& !g_test.video.frame
 			&& !g_test.video.mask.raw
 			&& !g_test.video.object_address.word
+			&& !g_test.video.scanline
 			&& !g_test.video.scroll_x.word
 			&& !g_test.video.scroll_y.word
 			&& !g_test.video.status.raw)) {
@@ -349,6 +661,339 @@ exit:
 	return result;
 }
 
+int
+nes_test_video_skip(void)
+{
+	int result = NES_OK;
+	nes_video_status_t status;
+	uint8_t scroll = rand();
+
+	nes_test_initialize();
+
+	for(uint32_t address = 0; address < VIDEO_PALETTE_RAM_BEGIN; ++address) {
+		g_test.memory.ptr[address] = rand();
+	}
+
+	for(uint32_t address = 0; address < g_test.object.length; ++address) {
+		g_test.object.ptr[address] = rand();
+	}
+
+	nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, 0x1e);
+	nes_video_synchronize(&g_test.video, ((VIDEO_HEIGHT / 2) * VIDEO_DOTS) / VIDEO_CYCLES);
+	nes_video_port_write(&g_test.video, VIDEO_PORT_SCROLL, scroll);
+	nes_video_port_write(&g_test.video, VIDEO_PORT_SCROLL, scroll);
+	nes_video_step(&g_test.video, g_test.video.event);
+	status.raw = g_test.video.status.raw;
+	nes_video_reset(&g_test.video);
+	g_test.pixel = 0;
+	g_test.video.skip = true;
+	nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, 0x1e);
+	nes_video_synchronize(&g_test.video, ((VIDEO_HEIGHT / 2) * VIDEO_DOTS) / VIDEO_CYCLES);
+	nes_video_port_write(&g_test.video, VIDEO_PORT_SCROLL, scroll);
+	nes_video_port_write(&g_test.video, VIDEO_PORT_SCROLL, scroll);
+
+	if(ASSERT(nes_video_step(&g_test.video, g_test.video.event)
+			&& !g_test.pixel
+			&& (g_test.video.status.raw == status.raw))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_video_reset(&g_test.video);
+
+	if(ASSERT(nes_video_band_load(&g_test.video, 4) == NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	g_test.video.skip = true;
+	nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, 0x1e);
+	nes_video_synchronize(&g_test.video, ((VIDEO_HEIGHT / 2) * VIDEO_DOTS) / VIDEO_CYCLES);
+	nes_video_port_write(&g_test.video, VIDEO_PORT_SCROLL, scroll);
+	nes_video_port_write(&g_test.video, VIDEO_PORT_SCROLL, scroll);
+
+	if(ASSERT(nes_video_step(&g_test.video, g_test.video.event)
+			&& !g_test.pixel
+			&& (g_test.video.status.raw == status.raw))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_video_band_unload(&g_test.video);
+	nes_video_reset(&g_test.video);
+
+	if(ASSERT(nes_video_pipeline_load(&g_test.video) == NES_OK)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	for(uint32_t frame = 0; frame < 3; ++frame) {
+		g_test.video.skip = (frame < 2);
+		nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, 0x1e);
+		nes_video_synchronize(&g_test.video, g_test.video.cycle + (((VIDEO_HEIGHT / 2) * VIDEO_DOTS) / VIDEO_CYCLES));
+		nes_video_port_write(&g_test.video, VIDEO_PORT_SCROLL, scroll);
+		nes_video_port_write(&g_test.video, VIDEO_PORT_SCROLL, scroll);
+
+		if(ASSERT(nes_video_step(&g_test.video, g_test.video.event)
+				&& g_test.video.skip
+				&& !g_test.pixel)) {
+			result = NES_ERR;
+			goto exit;
+		}
+	}
+
+	for(uint16_t y = 0; y < VIDEO_HEIGHT; ++y) {
+
+		for(uint16_t x = 0; x < VIDEO_WIDTH; ++x) {
+
+			if(ASSERT(!g_test.video.pipeline->frame[1][y][x])) {
+				result = NES_ERR;
+				goto exit;
+			}
+		}
+	}
+
+	g_test.video.skip = false;
+
+	if(ASSERT(nes_video_step(&g_test.video, g_test.video.event)
+			&& !g_test.video.skip
+			&& (g_test.pixel == (VIDEO_WIDTH * VIDEO_HEIGHT)))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	nes_video_band_unload(&g_test.video);
+	nes_video_pipeline_unload(&g_test.video);
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_video_sprite(void)
+{
+	uint32_t hit;
+	int result = NES_OK;
+	uint8_t x = VIDEO_TILE_WIDTH + (rand() % (VIDEO_WIDTH - (VIDEO_TILE_WIDTH * 3))), y = rand() % (VIDEO_HEIGHT / 2);
+
+	nes_test_initialize();
+	memset(g_test.memory.ptr, 0xff, VIDEO_TILE_BYTES);
+	g_test.object.ptr[0] = y;
+	g_test.object.ptr[3] = x;
+	nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, 0x1e);
+	hit = ((y + 1) * VIDEO_DOTS) + x + 1;
+	nes_video_synchronize(&g_test.video, (hit - 1) / VIDEO_CYCLES);
+
+	if(ASSERT((g_test.video.hit == hit)
+			&& !g_test.video.status.sprite_0_hit)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_video_synchronize(&g_test.video, (hit + (VIDEO_CYCLES - 1)) / VIDEO_CYCLES);
+
+	if(ASSERT(!g_test.video.hit
+			&& g_test.video.status.sprite_0_hit
+			&& (g_test.video.scanline == (y + 1))
+			&& (g_test.pixel == ((y + 1) * VIDEO_WIDTH))
+			&& (nes_video_port_read(&g_test.video, VIDEO_PORT_STATUS) & 0x40))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_video_step(&g_test.video, g_test.video.event);
+	nes_video_synchronize(&g_test.video, ((VIDEO_SCANLINES * VIDEO_DOTS) / VIDEO_CYCLES) + 1);
+
+	if(ASSERT(!g_test.video.status.sprite_0_hit
+			&& (g_test.video.hit == hit))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_video_port_write(&g_test.video, VIDEO_PORT_OBJECT_ADDRESS, 0);
+	nes_video_port_write(&g_test.video, VIDEO_PORT_OBJECT_DATA, y + (VIDEO_HEIGHT / 2));
+	hit += (VIDEO_HEIGHT / 2) * VIDEO_DOTS;
+	nes_video_synchronize(&g_test.video, ((VIDEO_SCANLINES * VIDEO_DOTS) + hit - 1) / VIDEO_CYCLES);
+
+	if(ASSERT((g_test.video.hit == hit)
+			&& !g_test.video.status.sprite_0_hit)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, 0x18);
+	nes_video_port_write(&g_test.video, VIDEO_PORT_OBJECT_ADDRESS, 3);
+	nes_video_port_write(&g_test.video, VIDEO_PORT_OBJECT_DATA, 0);
+	nes_video_step(&g_test.video, g_test.video.event);
+
+	if(ASSERT(!g_test.video.hit
+			&& !g_test.video.status.sprite_0_hit)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_video_step(void)
+{
+	uint64_t cycle;
+	int result = NES_OK;
+
+	nes_test_initialize();
+	cycle = g_test.video.event;
+
+	if(ASSERT(!nes_video_step(&g_test.video, cycle - 1)
+			&& !g_test.video.status.vblank
+			&& !g_test.interrupt
+			&& (g_test.video.event == cycle)
+			&& (g_test.pixel == (VIDEO_WIDTH * VIDEO_HEIGHT)))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	if(ASSERT(nes_video_step(&g_test.video, cycle)
+			&& g_test.video.status.vblank
+			&& !g_test.interrupt
+			&& (g_test.video.event > cycle))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_test_initialize();
+	g_test.video.control.interrupt = true;
+	cycle = g_test.video.event;
+
+	if(ASSERT(nes_video_step(&g_test.video, cycle)
+			&& g_test.video.status.vblank
+			&& g_test.interrupt)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	cycle = g_test.video.event;
+	g_test.interrupt = false;
+	g_test.pixel = 0;
+
+	if(ASSERT(nes_video_step(&g_test.video, cycle)
+			&& g_test.video.status.vblank
+			&& g_test.interrupt
+			&& (g_test.video.frame == 1)
+			&& (g_test.pixel == (VIDEO_WIDTH * VIDEO_HEIGHT)))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_test_initialize();
+	nes_video_synchronize(&g_test.video, g_test.video.event);
+
+	if(ASSERT(!g_test.interrupt
+			&& g_test.video.complete)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	g_test.video.control.interrupt = false;
+	nes_video_port_write(&g_test.video, VIDEO_PORT_CONTROL, 0x80);
+
+	if(ASSERT(g_test.interrupt)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	TRACE_RESULT(result);
+
+	return result;
+}
+
+int
+nes_test_video_surface(void)
+{
+	int result = NES_OK;
+	const uint16_t address[] = { 0x0000, 0x1000, 0x2000, 0x23c0, 0x2400, 0x27c0, 0x2800, 0x2bc0, 0x2c00, 0x2fc0, };
+
+	nes_test_initialize();
+
+	for(uint32_t address = 0; address < VIDEO_PALETTE_RAM_BEGIN; ++address) {
+		g_test.memory.ptr[address] = rand();
+	}
+
+	for(uint32_t address = VIDEO_PALETTE_RAM_BEGIN; address < VIDEO_ADDRESS_MIRROR; ++address) {
+		g_test.memory.ptr[address] = rand() % 0x40;
+	}
+
+	nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, 0x1e);
+	nes_video_step(&g_test.video, g_test.video.event);
+	memcpy(g_test.frame_tile, g_test.frame, sizeof(g_test.frame));
+	nes_video_reset(&g_test.video);
+
+	if(ASSERT((nes_video_surface_load(&g_test.video) == NES_OK)
+			&& g_test.video.surface
+			&& g_test.video.surface->dirty)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	nes_video_port_write(&g_test.video, VIDEO_PORT_MASK, 0x1e);
+
+	if(ASSERT(nes_video_step(&g_test.video, g_test.video.event)
+			&& !g_test.video.surface->dirty
+			&& !memcmp(g_test.frame, g_test.frame_tile, sizeof(g_test.frame)))) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+	for(int frame = 0; frame < 4; ++frame) {
+
+		for(size_t index = 0; index < TEST_COUNT(address); ++index) {
+			uint16_t offset = address[index] + (rand() % ((address[index] < VIDEO_RAM_BEGIN) ? VIDEO_PATTERN_TABLE_WIDTH : 0x40));
+
+			nes_video_port_write(&g_test.video, VIDEO_PORT_ADDRESS, offset >> 8);
+			nes_video_port_write(&g_test.video, VIDEO_PORT_ADDRESS, offset);
+			nes_video_port_write(&g_test.video, VIDEO_PORT_DATA, rand());
+		}
+
+		nes_video_port_write(&g_test.video, VIDEO_PORT_CONTROL, (frame % 2) ? 0x10 : 0x00);
+
+		if(ASSERT(g_test.video.surface->dirty)) {
+			result = NES_ERR;
+			goto exit;
+		}
+
+		nes_video_step(&g_test.video, g_test.video.event);
+		memcpy(g_test.frame_scroll, g_test.frame, sizeof(g_test.frame));
+		nes_video_surface_unload(&g_test.video);
+		nes_video_step(&g_test.video, g_test.video.event);
+
+		if(ASSERT(!memcmp(g_test.frame, g_test.frame_scroll, sizeof(g_test.frame))
+				&& (nes_video_surface_load(&g_test.video) == NES_OK))) {
+			result = NES_ERR;
+			goto exit;
+		}
+
+		nes_video_step(&g_test.video, g_test.video.event);
+	}
+
+	nes_video_surface_unload(&g_test.video);
+
+	if(ASSERT(!g_test.video.surface)) {
+		result = NES_ERR;
+		goto exit;
+	}
+
+exit:
+	nes_video_surface_unload(&g_test.video);
+	TRACE_RESULT(result);
+
+	return result;
+}
+
 int
 main(
 	__in int argc,
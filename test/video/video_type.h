@@ -26,8 +26,13 @@
 #include "../common.h"
 
 typedef struct {
+        uint16_t frame[VIDEO_HEIGHT][VIDEO_WIDTH];
+        uint16_t frame_scroll[VIDEO_HEIGHT][VIDEO_WIDTH];
+        uint16_t frame_tile[VIDEO_HEIGHT][VIDEO_WIDTH];
+        bool interrupt;
         nes_buffer_t memory;
         nes_buffer_t object;
+        uint32_t pixel;
         nes_video_t video;
 } nes_test_video_t;
 
@@ -35,18 +40,42 @@ typedef struct {
 extern "C" {
 #endif /* __cplusplus */
 
+int nes_test_video_band(void);
+
+int nes_test_video_blank(void);
+
+int nes_test_video_pipeline(void);
+
 int nes_test_video_port_read(void);
 
 int nes_test_video_port_write(void);
 
+int nes_test_video_render(void);
+
 int nes_test_video_reset(void);
 
+int nes_test_video_skip(void);
+
+int nes_test_video_sprite(void);
+
+int nes_test_video_step(void);
+
+int nes_test_video_surface(void);
+
 void nes_test_initialize(void);
 
 static const nes_test TEST[] = {
+        nes_test_video_band,
+        nes_test_video_blank,
+        nes_test_video_pipeline,
         nes_test_video_port_read,
         nes_test_video_port_write,
+        nes_test_video_render,
         nes_test_video_reset,
+        nes_test_video_skip,
+        nes_test_video_sprite,
+        nes_test_video_step,
+        nes_test_video_surface,
 	};
 
 #ifdef __cplusplus
@@ -0,0 +1,340 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "./capture_type.h"
+
+static nes_launcher_capture_t g_capture = {};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void
+nes_launcher_capture_audio(
+	__in const nes_samples_t *samples,
+	__in void *context
+	)
+{
+	uint32_t count = samples->count;
+	nes_launcher_capture_t *capture = context;
+
+	if(!capture->audio) {
+		return;
+	}
+
+	mtx_lock(&capture->lock);
+
+	while((CAPTURE_AUDIO_MAX - (capture->audio_write - capture->audio_read)) < count) {
+
+		if(capture->policy == CAPTURE_POLICY_DROP) {
+			capture->audio_dropped += count;
+			mtx_unlock(&capture->lock);
+			return;
+		}
+
+		cnd_wait(&capture->space, &capture->lock);
+	}
+
+	mtx_unlock(&capture->lock);
+
+	for(uint32_t index = 0; index < count; ++index) {
+		capture->sample[(capture->audio_write + index) % CAPTURE_AUDIO_MAX] = samples->buffer[index];
+	}
+
+	mtx_lock(&capture->lock);
+	capture->audio_write += count;
+	cnd_signal(&capture->update);
+	mtx_unlock(&capture->lock);
+}
+
+void
+nes_launcher_capture_frame(
+	__in const nes_frame_t *frame,
+	__in void *context
+	)
+{
+	nes_launcher_capture_frame_t *entry;
+	nes_launcher_capture_t *capture = context;
+
+	if(!capture->video || ((frame->pitch * frame->height) > sizeof(entry->data))) {
+		return;
+	}
+
+	mtx_lock(&capture->lock);
+
+	while((capture->frame_write - capture->frame_read) >= CAPTURE_FRAME_MAX) {
+
+		if(capture->policy == CAPTURE_POLICY_DROP) {
+			++capture->frame_dropped;
+			mtx_unlock(&capture->lock);
+			return;
+		}
+
+		cnd_wait(&capture->space, &capture->lock);
+	}
+
+	mtx_unlock(&capture->lock);
+	entry = &capture->frame[capture->frame_write % CAPTURE_FRAME_MAX];
+	memcpy(entry->data, frame->buffer, frame->pitch * frame->height);
+	entry->format = frame->format;
+	entry->pitch = frame->pitch;
+	mtx_lock(&capture->lock);
+	++capture->frame_write;
+	cnd_signal(&capture->update);
+	mtx_unlock(&capture->lock);
+}
+
+int
+nes_launcher_capture_load(
+	__inout nes_launcher_t *launcher
+	)
+{
+	int result = NES_OK;
+	nes_launcher_capture_t *capture = &g_capture;
+
+	if(!launcher->capture.audio && !launcher->capture.video) {
+		goto exit;
+	}
+
+	if(launcher->capture.video && (launcher->configuration.display.format == NES_FORMAT_INDEXED8)) {
+		fprintf(stderr, "%s: unsupported capture format -- indexed8\n", launcher->path);
+		result = NES_ERR;
+		goto exit;
+	}
+
+	memset(capture, 0, sizeof(*capture));
+	capture->policy = launcher->capture.policy;
+	capture->rate = launcher->configuration.sound.rate ? launcher->configuration.sound.rate : AUDIO_SAMPLE_RATE;
+
+	if(launcher->capture.video) {
+
+		if(!(capture->frame = calloc(CAPTURE_FRAME_MAX, sizeof(*capture->frame)))) {
+			fprintf(stderr, "%s: failed to allocate capture frames -- %.02f KB\n", launcher->path,
+				(CAPTURE_FRAME_MAX * sizeof(*capture->frame)) / (float)BYTES_PER_KBYTE);
+			result = NES_ERR;
+			goto exit;
+		}
+
+		if(!(capture->video = fopen(launcher->capture.video, "wb"))) {
+			fprintf(stderr, "%s: failed to open capture file -- %s\n", launcher->path, launcher->capture.video);
+			result = NES_ERR;
+			goto exit;
+		}
+
+		fprintf(capture->video, "YUV4MPEG2 W%u H%u F%s Ip A1:1 C444\n", VIDEO_WIDTH, VIDEO_HEIGHT, CAPTURE_FRAME_RATE);
+	}
+
+	if(launcher->capture.audio) {
+
+		if(!(capture->audio = fopen(launcher->capture.audio, "wb"))) {
+			fprintf(stderr, "%s: failed to open capture file -- %s\n", launcher->path, launcher->capture.audio);
+			result = NES_ERR;
+			goto exit;
+		}
+
+		nes_launcher_capture_wave(capture);
+	}
+
+	if((mtx_init(&capture->lock, mtx_plain) != thrd_success)
+			|| (cnd_init(&capture->space) != thrd_success)
+			|| (cnd_init(&capture->update) != thrd_success)) {
+		fprintf(stderr, "%s: failed to initialize capture synchronization\n", launcher->path);
+		result = NES_ERR;
+		goto exit;
+	}
+
+	capture->running = true;
+
+	if(thrd_create(&capture->thread, nes_launcher_capture_run, capture) != thrd_success) {
+		fprintf(stderr, "%s: failed to create capture thread\n", launcher->path);
+		capture->running = false;
+		cnd_destroy(&capture->update);
+		cnd_destroy(&capture->space);
+		mtx_destroy(&capture->lock);
+		result = NES_ERR;
+		goto exit;
+	}
+
+	launcher->configuration.callback.audio = nes_launcher_capture_audio;
+	launcher->configuration.callback.context = capture;
+	launcher->configuration.callback.frame = nes_launcher_capture_frame;
+
+exit:
+	return result;
+}
+
+int
+nes_launcher_capture_run(
+	__in void *context
+	)
+{
+	nes_launcher_capture_t *capture = context;
+
+	for(;;) {
+		uint64_t audio_begin, audio_end;
+		const nes_launcher_capture_frame_t *frame = NULL;
+
+		mtx_lock(&capture->lock);
+
+		while(capture->running && (capture->audio_read == capture->audio_write) && (capture->frame_read == capture->frame_write)) {
+			cnd_wait(&capture->update, &capture->lock);
+		}
+
+		if((capture->audio_read == capture->audio_write) && (capture->frame_read == capture->frame_write)) {
+			mtx_unlock(&capture->lock);
+			break;
+		}
+
+		audio_begin = capture->audio_read;
+		audio_end = capture->audio_write;
+
+		if(capture->frame_read != capture->frame_write) {
+			frame = &capture->frame[capture->frame_read % CAPTURE_FRAME_MAX];
+		}
+
+		mtx_unlock(&capture->lock);
+		nes_launcher_capture_write(capture, audio_begin, audio_end, frame);
+		mtx_lock(&capture->lock);
+		capture->audio_read = audio_end;
+
+		if(frame) {
+			++capture->frame_read;
+		}
+
+		cnd_broadcast(&capture->space);
+		mtx_unlock(&capture->lock);
+	}
+
+	return NES_OK;
+}
+
+void
+nes_launcher_capture_unload(
+	__in const nes_launcher_t *launcher
+	)
+{
+	nes_launcher_capture_t *capture = &g_capture;
+
+	if(capture->running) {
+		mtx_lock(&capture->lock);
+		capture->running = false;
+		cnd_signal(&capture->update);
+		mtx_unlock(&capture->lock);
+		thrd_join(capture->thread, NULL);
+		cnd_destroy(&capture->update);
+		cnd_destroy(&capture->space);
+		mtx_destroy(&capture->lock);
+		fprintf(stdout, "%s: captured %lu frames (%lu dropped), %lu samples (%lu dropped)\n", launcher->path, capture->frame_read,
+			capture->frame_dropped, capture->audio_read, capture->audio_dropped);
+	}
+
+	if(capture->audio) {
+		nes_launcher_capture_wave(capture);
+		fclose(capture->audio);
+	}
+
+	if(capture->video) {
+		fclose(capture->video);
+	}
+
+	free(capture->frame);
+	memset(capture, 0, sizeof(*capture));
+}
+
+void
+nes_launcher_capture_wave(
+	__inout nes_launcher_capture_t *capture
+	)
+{
+	uint8_t header[CAPTURE_WAVE_HEADER] = { 'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'A', 'V', 'E', 'f', 'm', 't', ' ', 16, 0, 0, 0, 1, 0,
+		CAPTURE_WAVE_CHANNELS, 0 };
+	uint32_t length = capture->audio_read * (CAPTURE_WAVE_BITS / CHAR_BIT), value[] = { CAPTURE_WAVE_HEADER - 8 + length, capture->rate,
+		capture->rate * CAPTURE_WAVE_CHANNELS * (CAPTURE_WAVE_BITS / CHAR_BIT), length };
+
+	for(uint32_t index = 0; index < sizeof(uint32_t); ++index) {
+		header[4 + index] = value[0] >> (index * CHAR_BIT);
+		header[24 + index] = value[1] >> (index * CHAR_BIT);
+		header[28 + index] = value[2] >> (index * CHAR_BIT);
+		header[40 + index] = value[3] >> (index * CHAR_BIT);
+	}
+
+	header[32] = CAPTURE_WAVE_CHANNELS * (CAPTURE_WAVE_BITS / CHAR_BIT);
+	header[34] = CAPTURE_WAVE_BITS;
+	memcpy(&header[36], "data", 4);
+	fseek(capture->audio, 0, SEEK_SET);
+	fwrite(header, sizeof(header), 1, capture->audio);
+	fseek(capture->audio, 0, SEEK_END);
+}
+
+void
+nes_launcher_capture_write(
+	__inout nes_launcher_capture_t *capture,
+	__in uint64_t audio_begin,
+	__in uint64_t audio_end,
+	__in const nes_launcher_capture_frame_t *frame
+	)
+{
+
+	for(uint64_t index = audio_begin; index < audio_end; ++index) {
+		int16_t sample = capture->sample[index % CAPTURE_AUDIO_MAX];
+		uint8_t data[] = { sample, sample >> CHAR_BIT };
+
+		fwrite(data, sizeof(data), 1, capture->audio);
+	}
+
+	if(!frame) {
+		return;
+	}
+
+	for(uint32_t y = 0; y < VIDEO_HEIGHT; ++y) {
+		const uint8_t *row = &frame->data[y * frame->pitch];
+
+		for(uint32_t x = 0; x < VIDEO_WIDTH; ++x) {
+			int red, green, blue;
+			uint32_t index = (y * VIDEO_WIDTH) + x;
+
+			if(frame->format == NES_FORMAT_RGB565) {
+				uint16_t color = row[x * 2] | (row[(x * 2) + 1] << CHAR_BIT);
+
+				red = ((color >> 11) << 3) | (color >> 13);
+				green = (((color >> 5) & 0x3f) << 2) | ((color >> 9) & 0x03);
+				blue = ((color & 0x1f) << 3) | ((color >> 2) & 0x07);
+			} else {
+				const nes_color_t *color = &((const nes_color_t *)row)[x];
+
+				red = color->red;
+				green = color->green;
+				blue = color->blue;
+			}
+
+			capture->plane[0][index] = (((66 * red) + (129 * green) + (25 * blue) + 128) >> 8) + 16;
+			capture->plane[1][index] = (((-38 * red) - (74 * green) + (112 * blue) + 128) >> 8) + 128;
+			capture->plane[2][index] = (((112 * red) - (94 * green) - (18 * blue) + 128) >> 8) + 128;
+		}
+	}
+
+	fprintf(capture->video, "FRAME\n");
+	fwrite(capture->plane, sizeof(capture->plane), 1, capture->video);
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,95 @@
+/**
+ * NES
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NES_LAUNCHER_CAPTURE_TYPE_H_
+#define NES_LAUNCHER_CAPTURE_TYPE_H_
+
+#include <threads.h>
+#include "./common.h"
+
+#define CAPTURE_AUDIO_MAX 0x10000
+#define CAPTURE_FRAME_MAX 8
+#define CAPTURE_FRAME_RATE "39375000:655171"
+#define CAPTURE_WAVE_BITS 16
+#define CAPTURE_WAVE_CHANNELS 1
+#define CAPTURE_WAVE_HEADER 44
+
+typedef struct {
+	uint8_t data[VIDEO_HEIGHT * VIDEO_WIDTH * sizeof(nes_color_t)];
+	int format;
+	size_t pitch;
+} nes_launcher_capture_frame_t;
+
+typedef struct {
+	FILE *audio;
+	uint64_t audio_dropped;
+	uint64_t audio_read;
+	uint64_t audio_write;
+	nes_launcher_capture_frame_t *frame;
+	uint64_t frame_dropped;
+	uint64_t frame_read;
+	uint64_t frame_write;
+	mtx_t lock;
+	uint8_t plane[3][VIDEO_HEIGHT * VIDEO_WIDTH];
+	int policy;
+	unsigned rate;
+	bool running;
+	int16_t sample[CAPTURE_AUDIO_MAX];
+	cnd_t space;
+	thrd_t thread;
+	cnd_t update;
+	FILE *video;
+} nes_launcher_capture_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void nes_launcher_capture_audio(
+	__in const nes_samples_t *samples,
+	__in void *context
+	);
+
+void nes_launcher_capture_frame(
+	__in const nes_frame_t *frame,
+	__in void *context
+	);
+
+int nes_launcher_capture_run(
+	__in void *context
+	);
+
+void nes_launcher_capture_wave(
+	__inout nes_launcher_capture_t *capture
+	);
+
+void nes_launcher_capture_write(
+	__inout nes_launcher_capture_t *capture,
+	__in uint64_t audio_begin,
+	__in uint64_t audio_end,
+	__in const nes_launcher_capture_frame_t *frame
+	);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NES_LAUNCHER_CAPTURE_TYPE_H_ */
@@ -26,9 +26,23 @@
 
 #define NOTICE "Copyright (C) 2021 David Jolly"
 
+enum {
+        CAPTURE_POLICY_DROP = 0,
+        CAPTURE_POLICY_BLOCK,
+        CAPTURE_POLICY_MAX,
+};
+
 typedef struct {
+
+        struct {
+                const char *audio;
+                int policy;
+                const char *video;
+        } capture;
+
         nes_t configuration;
         bool debug;
+        const char *palette;
         const char *path;
         nes_action_t request;
         nes_action_t response;
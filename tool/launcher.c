@@ -28,13 +28,16 @@ extern "C" {
 #endif /* __cplusplus */
 
 int
-nes_launcher_load(void)
+nes_launcher_file(
+	__in const char *path,
+	__inout nes_buffer_t *buffer
+	)
 {
 	FILE *file;
 	int length, result = NES_OK;
 
-	if(!(file = fopen(g_launcher.configuration.rom.path, "rb"))) {
-		fprintf(stderr, "%s: file not found -- %s\n", g_launcher.path, g_launcher.configuration.rom.path);
+	if(!(file = fopen(path, "rb"))) {
+		fprintf(stderr, "%s: file not found -- %s\n", g_launcher.path, path);
 		result = NES_ERR;
 		goto exit;
 	}
@@ -44,23 +47,23 @@ nes_launcher_load(void)
 	fseek(file, 0, SEEK_SET);
 
 	if(length < 0) {
-		fprintf(stderr, "%s: malformed file -- %s\n", g_launcher.path, g_launcher.configuration.rom.path);
+		fprintf(stderr, "%s: malformed file -- %s\n", g_launcher.path, path);
 		result = NES_ERR;
 		goto exit;
 	} else if(!length) {
-		fprintf(stderr, "%s: empty file -- %s\n", g_launcher.path, g_launcher.configuration.rom.path);
+		fprintf(stderr, "%s: empty file -- %s\n", g_launcher.path, path);
 		result = NES_ERR;
 		goto exit;
 	}
 
-	if((result = nes_buffer_allocate(&g_launcher.configuration.rom.data, length, 0)) != NES_OK) {
+	if((result = nes_buffer_allocate(buffer, length, 0)) != NES_OK) {
 		fprintf(stderr, "%s: %s\n", g_launcher.path, nes_error());
 		goto exit;
 	}
 
-	if(fread(g_launcher.configuration.rom.data.ptr, sizeof(uint8_t), g_launcher.configuration.rom.data.length, file) != g_launcher.configuration.rom.data.length) {
-		fprintf(stderr, "%s: file read error -- %s {%.02f KB (%zu bytes)}\n", g_launcher.path, g_launcher.configuration.rom.path,
-			g_launcher.configuration.rom.data.length / (float)BYTES_PER_KBYTE, g_launcher.configuration.rom.data.length);
+	if(fread(buffer->ptr, sizeof(uint8_t), buffer->length, file) != buffer->length) {
+		fprintf(stderr, "%s: file read error -- %s {%.02f KB (%zu bytes)}\n", g_launcher.path, path,
+			buffer->length / (float)BYTES_PER_KBYTE, buffer->length);
 		result = NES_ERR;
 		goto exit;
 	}
@@ -75,9 +78,27 @@ exit:
 	return result;
 }
 
+int
+nes_launcher_load(void)
+{
+	int result;
+
+	if((result = nes_launcher_file(g_launcher.configuration.rom.path, &g_launcher.configuration.rom.data)) != NES_OK) {
+		goto exit;
+	}
+
+	if(g_launcher.palette && ((result = nes_launcher_file(g_launcher.palette, &g_launcher.configuration.display.palette)) != NES_OK)) {
+		goto exit;
+	}
+
+exit:
+	return result;
+}
+
 void
 nes_launcher_unload(void)
 {
+	nes_buffer_free(&g_launcher.configuration.display.palette);
 	nes_buffer_free(&g_launcher.configuration.rom.data);
 	memset(&g_launcher, 0, sizeof(g_launcher));
 }
@@ -123,8 +144,16 @@ main(
 
 	g_launcher.path = argv[0];
 	g_launcher.version = nes_version();
+	g_launcher.configuration.display.band = DISPLAY_BAND;
+	g_launcher.configuration.display.filter = DISPLAY_FILTER;
+	g_launcher.configuration.display.format = DISPLAY_FORMAT;
 	g_launcher.configuration.display.fullscreen = DISPLAY_FULLSCREEN;
+	g_launcher.configuration.display.pipeline = DISPLAY_PIPELINE;
+	g_launcher.configuration.display.runahead = DISPLAY_RUNAHEAD;
 	g_launcher.configuration.display.scale = DISPLAY_SCALE;
+	g_launcher.configuration.display.skip = DISPLAY_SKIP;
+	g_launcher.configuration.replay.rewind = REPLAY_REWIND;
+	g_launcher.configuration.sound.rate = SOUND_RATE;
 
 	if(!argc) {
 		nes_launcher_usage(stderr, false);
@@ -137,21 +166,111 @@ main(
 	while((option = getopt(argc, argv, OPTIONS)) != -1) {
 
 		switch(option) {
+			case OPTION_AUDIO:
+				g_launcher.configuration.sound.rate = strtol(optarg, NULL, 10);
+				break;
+			case OPTION_BAND:
+				g_launcher.configuration.display.band = strtol(optarg, NULL, 10);
+				break;
+			case OPTION_COLOR:
+				g_launcher.palette = optarg;
+				break;
 			case OPTION_DEBUG:
 				g_launcher.debug = true;
 				break;
 			case OPTION_FULLSCREEN:
 				g_launcher.configuration.display.fullscreen = true;
 				break;
+			case OPTION_FORMAT:
+
+				for(g_launcher.configuration.display.format = 0; g_launcher.configuration.display.format < NES_FORMAT_MAX;
+						++g_launcher.configuration.display.format) {
+
+					if(!strcmp(optarg, FORMAT[g_launcher.configuration.display.format])) {
+						break;
+					}
+				}
+
+				if(g_launcher.configuration.display.format == NES_FORMAT_MAX) {
+					fprintf(stderr, "%s: unsupported format -- %s\n", g_launcher.path, optarg);
+					nes_launcher_usage(stderr, false);
+					result = NES_ERR;
+					goto exit;
+				}
+				break;
 			case OPTION_HELP:
 				nes_launcher_usage(stdout, true);
 				goto exit;
+			case OPTION_PIPELINE:
+				g_launcher.configuration.display.pipeline = true;
+				break;
+			case OPTION_QUEUE:
+
+				for(g_launcher.capture.policy = 0; g_launcher.capture.policy < CAPTURE_POLICY_MAX; ++g_launcher.capture.policy) {
+
+					if(!strcmp(optarg, POLICY[g_launcher.capture.policy])) {
+						break;
+					}
+				}
+
+				if(g_launcher.capture.policy == CAPTURE_POLICY_MAX) {
+					fprintf(stderr, "%s: unsupported capture policy -- %s\n", g_launcher.path, optarg);
+					nes_launcher_usage(stderr, false);
+					result = NES_ERR;
+					goto exit;
+				}
+				break;
+			case OPTION_PLAYBACK:
+			case OPTION_RECORD:
+
+				if(g_launcher.configuration.replay.path) {
+					fprintf(stderr, "%s: redefined movie path -- %s\n", g_launcher.path, optarg);
+					nes_launcher_usage(stderr, false);
+					result = NES_ERR;
+					goto exit;
+				}
+
+				g_launcher.configuration.replay.mode = (option == OPTION_RECORD) ? NES_REPLAY_RECORD : NES_REPLAY_PLAYBACK;
+				g_launcher.configuration.replay.path = optarg;
+				break;
+			case OPTION_REWIND:
+				g_launcher.configuration.replay.rewind = strtol(optarg, NULL, 10);
+				break;
+			case OPTION_RUNAHEAD:
+				g_launcher.configuration.display.runahead = strtol(optarg, NULL, 10);
+				break;
 			case OPTION_SCALE:
 				g_launcher.configuration.display.scale = strtol(optarg, NULL, 10);
 				break;
+			case OPTION_SKIP:
+				g_launcher.configuration.display.skip = strtol(optarg, NULL, 10);
+				break;
 			case OPTION_VERSION:
 				nes_launcher_version(stdout, false);
 				goto exit;
+			case OPTION_WAVE:
+				g_launcher.capture.audio = optarg;
+				break;
+			case OPTION_YUV:
+				g_launcher.capture.video = optarg;
+				break;
+			case OPTION_FILTER:
+
+				for(g_launcher.configuration.display.filter = 0; g_launcher.configuration.display.filter < NES_FILTER_MAX;
+						++g_launcher.configuration.display.filter) {
+
+					if(!strcmp(optarg, FILTER[g_launcher.configuration.display.filter])) {
+						break;
+					}
+				}
+
+				if(g_launcher.configuration.display.filter == NES_FILTER_MAX) {
+					fprintf(stderr, "%s: unsupported filter -- %s\n", g_launcher.path, optarg);
+					nes_launcher_usage(stderr, false);
+					result = NES_ERR;
+					goto exit;
+				}
+				break;
 			case '?':
 			default:
 				nes_launcher_usage(stderr, false);
@@ -183,6 +302,10 @@ main(
 		goto exit;
 	}
 
+	if((result = nes_launcher_capture_load(&g_launcher)) != NES_OK) {
+		goto exit;
+	}
+
 	if((result = nes_load(&g_launcher.configuration)) != NES_OK) {
 		fprintf(stderr, "%s: %s\n", g_launcher.path, nes_error());
 		goto exit;
@@ -201,6 +324,7 @@ main(
 
 exit:
 	nes_unload();
+	nes_launcher_capture_unload(&g_launcher);
 	nes_launcher_unload();
 
 	return result;
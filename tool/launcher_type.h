@@ -25,51 +25,149 @@
 #include <getopt.h>
 #include "./common.h"
 
+#define DISPLAY_BAND 1
+#define DISPLAY_FILTER NES_FILTER_NONE
+#define DISPLAY_FORMAT NES_FORMAT_ARGB8888
 #define DISPLAY_FULLSCREEN false
+#define DISPLAY_PIPELINE false
+#define DISPLAY_RUNAHEAD 0
 #define DISPLAY_SCALE 2
+#define DISPLAY_SKIP 4
 
+#define REPLAY_REWIND 0
+
+#define SOUND_RATE 44100
+
+#define OPTION_AUDIO 'a'
+#define OPTION_BAND 'b'
+#define OPTION_COLOR 'c'
 #define OPTION_DEBUG 'd'
+#define OPTION_REWIND 'e'
 #define OPTION_FULLSCREEN 'f'
 #define OPTION_HELP 'h'
+#define OPTION_SKIP 'k'
+#define OPTION_RUNAHEAD 'l'
+#define OPTION_PLAYBACK 'm'
+#define OPTION_FORMAT 'o'
+#define OPTION_PIPELINE 'p'
+#define OPTION_QUEUE 'q'
+#define OPTION_RECORD 'r'
 #define OPTION_SCALE 's'
 #define OPTION_VERSION 'v'
-#define OPTIONS "dfhs:v"
+#define OPTION_WAVE 'w'
+#define OPTION_FILTER 'x'
+#define OPTION_YUV 'y'
+#define OPTIONS "a:b:c:de:fhk:l:m:o:pq:r:s:vw:x:y:"
 
 #define USAGE "nes [options] file"
 
 enum {
-	FLAG_DEBUG = 0,
+	FLAG_AUDIO = 0,
+	FLAG_BAND,
+	FLAG_COLOR,
+	FLAG_DEBUG,
+	FLAG_REWIND,
 	FLAG_FULLSCREEN,
 	FLAG_HELP,
+	FLAG_SKIP,
+	FLAG_RUNAHEAD,
+	FLAG_PLAYBACK,
+	FLAG_FORMAT,
+	FLAG_PIPELINE,
+	FLAG_QUEUE,
+	FLAG_RECORD,
 	FLAG_SCALE,
 	FLAG_VERSION,
+	FLAG_WAVE,
+	FLAG_FILTER,
+	FLAG_YUV,
 	FLAG_MAX,
 };
 
 static const char *FLAG[] = {
+	"-a", /* FLAG_AUDIO */
+	"-b", /* FLAG_BAND */
+	"-c", /* FLAG_COLOR */
 	"-d", /* FLAG_DEBUG */
+	"-e", /* FLAG_REWIND */
 	"-f", /* FLAG_FULLSCREEN */
 	"-h", /* FLAG_HELP */
+	"-k", /* FLAG_SKIP */
+	"-l", /* FLAG_RUNAHEAD */
+	"-m", /* FLAG_PLAYBACK */
+	"-o", /* FLAG_FORMAT */
+	"-p", /* FLAG_PIPELINE */
+	"-q", /* FLAG_QUEUE */
+	"-r", /* FLAG_RECORD */
 	"-s", /* FLAG_SCALE */
 	"-v", /* FLAG_VERSION */
+	"-w", /* FLAG_WAVE */
+	"-x", /* FLAG_FILTER */
+	"-y", /* FLAG_YUV */
 	};
 
 static const char *FLAG_DESC[] = {
+	"Audio sample rate", /* FLAG_AUDIO */
+	"Band rendering threads", /* FLAG_BAND */
+	"Load color palette", /* FLAG_COLOR */
 	"Enter debug mode", /* FLAG_DEBUG */
+	"Rewind buffer size (MB)", /* FLAG_REWIND */
 	"Fullscreen display", /* FLAG_FULLSCREEN */
 	"Show help information", /* FLAG_HELP */
+	"Fast-forward frame skip", /* FLAG_SKIP */
+	"Run-ahead frames", /* FLAG_RUNAHEAD */
+	"Playback movie", /* FLAG_PLAYBACK */
+	"Framebuffer format", /* FLAG_FORMAT */
+	"Pipelined rendering", /* FLAG_PIPELINE */
+	"Capture queue policy", /* FLAG_QUEUE */
+	"Record movie", /* FLAG_RECORD */
 	"Scale display", /* FLAG_SCALE */
 	"Show version information", /* FLAG_VERSION */
+	"Capture audio (WAV)", /* FLAG_WAVE */
+	"Post-process filter", /* FLAG_FILTER */
+	"Capture video (Y4M)", /* FLAG_YUV */
+	};
+
+static const char *FILTER[] = {
+	"none", /* NES_FILTER_NONE */
+	"scale2x", /* NES_FILTER_SCALE2X */
+	"scale3x", /* NES_FILTER_SCALE3X */
+	"hq2x", /* NES_FILTER_HQ2X */
+	"ntsc", /* NES_FILTER_NTSC */
+	};
+
+static const char *FORMAT[] = {
+	"argb8888", /* NES_FORMAT_ARGB8888 */
+	"rgb565", /* NES_FORMAT_RGB565 */
+	"indexed8", /* NES_FORMAT_INDEXED8 */
+	};
+
+static const char *POLICY[] = {
+	"drop", /* CAPTURE_POLICY_DROP */
+	"block", /* CAPTURE_POLICY_BLOCK */
 	};
 
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
 
+int nes_launcher_capture_load(
+	__inout nes_launcher_t *launcher
+	);
+
+void nes_launcher_capture_unload(
+	__in const nes_launcher_t *launcher
+	);
+
 void nes_launcher_debug(
 	__in const nes_launcher_t *launcher
 	);
 
+int nes_launcher_file(
+	__in const char *path,
+	__inout nes_buffer_t *buffer
+	);
+
 int nes_launcher_load(void);
 
 void nes_launcher_unload(void);